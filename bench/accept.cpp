@@ -0,0 +1,102 @@
+//
+// Loopback connection-accept rate: one accept submission per connection
+// versus a single multishot accept.
+//
+
+#include <rcs/co/awaitable.hpp>
+#include <rcs/execution/inline_executor.hpp>
+#include <rcs/io/service.hpp>
+#include <rcs/ip/address.hpp>
+#include <rcs/ip/endpoint.hpp>
+#include <rcs/ip/socket.hpp>
+#include <rcs/ip/v4.hpp>
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+#include <cstdint>
+
+namespace {
+
+using service_t = rcs::io::service<rcs::execution::inline_executor>;
+using socket_t  = rcs::ip::v4::tcp::socket<rcs::execution::inline_executor>;
+
+auto listen(socket_t &listener) -> std::uint16_t {
+    listener.open();
+    listener.bind(rcs::ip::v4::endpoint(rcs::ip::v4::address::loopback(), 0));
+    listener.listen(SOMAXCONN);
+
+    struct ::sockaddr_in address = {};
+    ::socklen_t          size    = sizeof(address);
+    ::getsockname(listener.descriptor(), reinterpret_cast<struct ::sockaddr *>(&address), &size);
+    return ntohs(address.sin_port);
+}
+
+void connect(std::uint16_t port, std::uint32_t count) {
+    const rcs::ip::v4::endpoint endpoint(rcs::ip::v4::address::loopback(), port);
+
+    for (std::uint32_t index = 0; index < count; ++index) {
+        const std::int32_t descriptor = ::socket(AF_INET, SOCK_STREAM, 0);
+        if (::connect(descriptor, &endpoint.data(), endpoint.size()) == -1)
+            std::perror("connect");
+        ::close(descriptor);
+    }
+}
+
+auto single(socket_t &listener, std::uint32_t count) -> rcs::co::awaitable<std::uint32_t> {
+    std::uint32_t accepted = 0;
+    while (accepted < count) {
+        (void)co_await listener.accept();
+        ++accepted;
+    }
+    co_return accepted;
+}
+
+auto incoming(socket_t &listener, std::uint32_t count) -> rcs::co::awaitable<std::uint32_t> {
+    auto          connections = listener.incoming();
+    std::uint32_t accepted    = 0;
+    while (accepted < count) {
+        if (not(co_await connections.next()).has_value()) break;
+        ++accepted;
+    }
+    co_return accepted;
+}
+
+template <typename TAcceptor>
+void measure(const char *name, std::uint32_t count, TAcceptor acceptor) {
+    service_t           service({}, 64);
+    socket_t            listener(service);
+    const std::uint16_t port = listen(listener);
+
+    const auto  start  = std::chrono::steady_clock::now();
+    std::thread client = std::thread(connect, port, count);
+
+    auto accepted = acceptor(listener, count);
+    while (not accepted.done()) service.run_one();
+
+    const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start);
+    client.join();
+    service.run();
+
+    std::printf("%-10s %8u connections in %8.3f ms (%10.0f conn/s)\n",
+                name, accepted.result(), elapsed.count() * 1e3,
+                accepted.result() / elapsed.count());
+}
+
+} // namespace
+
+auto main(int argc, char **argv) -> int {
+    const std::uint32_t count =
+        argc > 1 ? static_cast<std::uint32_t>(std::strtoul(argv[1], nullptr, 10)) : 20000;
+
+    measure("accept", count, single);
+    measure("multishot", count, incoming);
+
+    return 0;
+}
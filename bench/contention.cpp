@@ -0,0 +1,89 @@
+//
+// Initiation throughput of a single service driven by several producer
+// threads at once, while another thread runs the event processing loop.
+//
+
+#include <rcs/co/awaitable.hpp>
+#include <rcs/execution/inline_executor.hpp>
+#include <rcs/io/options.hpp>
+#include <rcs/io/service.hpp>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <thread>
+#include <vector>
+
+#include <cstdint>
+
+namespace {
+
+using service_t = rcs::io::service<rcs::execution::inline_executor>;
+
+auto write(service_t &service, std::int32_t descriptor, std::atomic<std::uint32_t> &completed)
+    -> rcs::co::awaitable<void> {
+    static constexpr std::array<char, 1> data = {'x'};
+    (void)co_await service.write(descriptor, data.data(), data.size());
+    completed.fetch_add(1, std::memory_order::relaxed);
+}
+
+void produce(service_t &service, std::int32_t descriptor, std::uint32_t count, std::uint32_t total,
+             std::atomic<std::uint32_t> &completed, std::atomic<bool> &start) {
+    std::vector<rcs::co::awaitable<void>> operations;
+    operations.reserve(count);
+
+    while (not start.load()) std::this_thread::yield();
+    for (std::uint32_t index = 0; index < count; ++index)
+        operations.push_back(write(service, descriptor, completed));
+
+    // The operations are resumed by the event processing loop, and must
+    // stay alive until then.
+    while (completed.load() < total) std::this_thread::yield();
+}
+
+void measure(const char *name, const rcs::io::options &options, std::uint32_t producers, std::uint32_t count) {
+    service_t          service({}, 4096, options);
+    const std::int32_t descriptor = ::open("/dev/null", O_WRONLY);
+
+    std::atomic<std::uint32_t> completed = 0;
+    std::atomic<bool>          start     = false;
+
+    const std::uint32_t total = producers * count;
+
+    std::vector<std::thread> threads;
+    for (std::uint32_t index = 0; index < producers; ++index)
+        threads.emplace_back(produce, std::ref(service), descriptor, count, total,
+                             std::ref(completed), std::ref(start));
+
+    const auto started = std::chrono::steady_clock::now();
+
+    start.store(true);
+    while (completed.load() < total) (void)service.run_batch();
+
+    const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - started);
+
+    for (std::thread &thread : threads) thread.join();
+    ::close(descriptor);
+
+    std::printf("%-10s %2u producers %10.0f ops/s\n", name, producers, total / elapsed.count());
+}
+
+} // namespace
+
+auto main(int argc, char **argv) -> int {
+    const std::uint32_t count =
+        argc > 1 ? static_cast<std::uint32_t>(std::strtoul(argv[1], nullptr, 10)) : 100000;
+
+    for (const std::uint32_t producers : {2U, 4U, 8U}) {
+        measure("immediate", {.submission = rcs::io::submission::immediate}, producers, count);
+        measure("deferred", {.submission = rcs::io::submission::deferred}, producers, count);
+    }
+
+    return 0;
+}
@@ -0,0 +1,100 @@
+//
+// Write/read round trips through a memory-backed file: plain operations on
+// ordinary buffers versus fixed operations on registered buffers.
+//
+
+#include <rcs/co/awaitable.hpp>
+#include <rcs/execution/inline_executor.hpp>
+#include <rcs/io/buffer_arena.hpp>
+#include <rcs/io/service.hpp>
+#include <rcs/io/slice.hpp>
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include <cstdint>
+
+namespace {
+
+using service_t = rcs::io::service<rcs::execution::inline_executor>;
+
+constexpr std::uint32_t LANES = 16;
+
+auto plain(service_t &service, std::int32_t descriptor, std::uint32_t lane,
+           std::uint32_t size, std::uint32_t count) -> rcs::co::awaitable<std::uint64_t> {
+    std::vector<std::uint8_t> buffer(size, static_cast<std::uint8_t>(lane));
+    const std::uint64_t       offset = static_cast<std::uint64_t>(lane) * size;
+
+    std::uint64_t bytes = 0;
+    for (std::uint32_t index = 0; index < count; ++index) {
+        const std::int32_t written = co_await service.write(descriptor, buffer.data(), size, offset);
+        const std::int32_t read    = co_await service.read(descriptor, buffer.data(), size, offset);
+        if (written < 0 or read < 0) break;
+        bytes += static_cast<std::uint64_t>(written) + static_cast<std::uint64_t>(read);
+    }
+    co_return bytes;
+}
+
+auto fixed(service_t &service, std::int32_t descriptor, std::uint32_t lane,
+           std::uint32_t size, std::uint32_t count) -> rcs::co::awaitable<std::uint64_t> {
+    const rcs::io::slice slice  = service.buffers()->acquire();
+    const std::uint64_t  offset = static_cast<std::uint64_t>(lane) * size;
+
+    std::uint64_t bytes = 0;
+    for (std::uint32_t index = 0; index < count; ++index) {
+        const std::int32_t written = co_await service.write_fixed(descriptor, slice, size, offset);
+        const std::int32_t read    = co_await service.read_fixed(descriptor, slice, size, offset);
+        if (written < 0 or read < 0) break;
+        bytes += static_cast<std::uint64_t>(written) + static_cast<std::uint64_t>(read);
+    }
+    co_return bytes;
+}
+
+template <typename TLane>
+void measure(const char *name, std::uint32_t size, std::uint32_t count, TLane lane) {
+    service_t service({}, 2 * LANES);
+    (void)service.register_buffers(LANES, size);
+
+    const std::int32_t descriptor = ::memfd_create("rcs-bench-fixed", 0);
+    if (descriptor == -1) {
+        std::perror("memfd_create");
+        return;
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+
+    std::vector<rcs::co::awaitable<std::uint64_t>> lanes;
+    lanes.reserve(LANES);
+    for (std::uint32_t index = 0; index < LANES; ++index)
+        lanes.push_back(lane(service, descriptor, index, size, count / LANES));
+    service.run();
+
+    const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start);
+
+    std::uint64_t bytes = 0;
+    for (const auto &l : lanes) bytes += l.result();
+    ::close(descriptor);
+
+    std::printf("%-6s %8u round trips of %7u B in %8.3f ms (%8.1f MiB/s)\n",
+                name, count / LANES * LANES, size, elapsed.count() * 1e3,
+                static_cast<double>(bytes) / elapsed.count() / (1024.0 * 1024.0));
+}
+
+} // namespace
+
+auto main(int argc, char **argv) -> int {
+    const std::uint32_t count =
+        argc > 1 ? static_cast<std::uint32_t>(std::strtoul(argv[1], nullptr, 10)) : 100000;
+    const std::uint32_t size =
+        argc > 2 ? static_cast<std::uint32_t>(std::strtoul(argv[2], nullptr, 10)) : 65536;
+
+    measure("plain", size, count, plain);
+    measure("fixed", size, count, fixed);
+
+    return 0;
+}
@@ -0,0 +1,135 @@
+//
+// Loopback echo throughput of a single service under every ring setup
+// profile, with and without spinning on the completion queue before
+// blocking. The service is driven by a thread of its own.
+//
+
+#include <rcs/co/awaitable.hpp>
+#include <rcs/execution/inline_executor.hpp>
+#include <rcs/io/options.hpp>
+#include <rcs/io/service.hpp>
+#include <rcs/ip/address.hpp>
+#include <rcs/ip/endpoint.hpp>
+#include <rcs/ip/socket.hpp>
+#include <rcs/ip/v4.hpp>
+#include <rcs/system/timeout.hpp>
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#include <cstdint>
+
+namespace {
+
+using service_t = rcs::io::service<rcs::execution::inline_executor>;
+using socket_t  = rcs::ip::v4::tcp::socket<rcs::execution::inline_executor>;
+
+constexpr std::uint32_t MESSAGE = 64;
+
+auto session(socket_t connection) -> rcs::co::awaitable<void> {
+    std::array<char, MESSAGE> buffer = {};
+
+    while (true) {
+        std::uint32_t size = buffer.size();
+        co_await connection.recvall(buffer.data(), &size);
+        if (size != buffer.size()) co_return;
+        co_await connection.sendall(buffer.data(), &size);
+    }
+}
+
+auto serve(socket_t &listener, std::vector<rcs::co::awaitable<void>> &sessions, std::uint32_t connections)
+    -> rcs::co::awaitable<void> {
+    while (sessions.size() < connections) {
+        try {
+            sessions.push_back(session(co_await listener.accept(std::chrono::milliseconds(50))));
+        } catch (const rcs::system::timeout &) {}
+    }
+}
+
+void client(std::uint16_t port, std::uint32_t requests) {
+    const rcs::ip::v4::endpoint endpoint(rcs::ip::v4::address::loopback(), port);
+    std::array<char, MESSAGE>   buffer = {};
+
+    const std::int32_t descriptor = ::socket(AF_INET, SOCK_STREAM, 0);
+    if (::connect(descriptor, &endpoint.data(), endpoint.size()) == -1)
+        std::perror("connect");
+
+    for (std::uint32_t request = 0; request < requests; ++request) {
+        (void)::send(descriptor, buffer.data(), buffer.size(), MSG_NOSIGNAL);
+        (void)::recv(descriptor, buffer.data(), buffer.size(), MSG_WAITALL);
+    }
+
+    ::close(descriptor);
+}
+
+void measure(const char *name, const rcs::io::options &options, std::uint32_t clients, std::uint32_t requests) {
+    service_t service({}, 256, options);
+    socket_t  listener(service);
+    listener.open();
+    listener.bind(rcs::ip::v4::endpoint(rcs::ip::v4::address::loopback(), 0));
+    listener.listen(SOMAXCONN);
+
+    struct ::sockaddr_in address = {};
+    ::socklen_t          size    = sizeof(address);
+    ::getsockname(listener.descriptor(), reinterpret_cast<struct ::sockaddr *>(&address), &size);
+    const std::uint16_t port = ntohs(address.sin_port);
+
+    // The loop is run by a thread of its own, which becomes the single
+    // issuer where applicable.
+    // The sessions must outlive the loop.
+    std::vector<rcs::co::awaitable<void>> sessions;
+    std::thread                           loop([&] {
+        const rcs::co::awaitable<void> server = serve(listener, sessions, clients);
+        service.run();
+        server.rethrow_exception();
+    });
+
+    const auto               start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (std::uint32_t index = 0; index < clients; ++index)
+        threads.emplace_back(client, port, requests);
+    for (std::thread &thread : threads) thread.join();
+    const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start);
+
+    loop.join();
+
+    const auto enters = service.stats().enters;
+    std::printf("%-14s %-6s %12.0f req/s %10llu enters\n", name,
+                options.wait.spin.count() != 0 ? "spin" : "block",
+                static_cast<double>(clients) * requests / elapsed.count(),
+                static_cast<unsigned long long>(enters));
+}
+
+} // namespace
+
+auto main(int argc, char **argv) -> int {
+    const std::uint32_t clients =
+        argc > 1 ? static_cast<std::uint32_t>(std::strtoul(argv[1], nullptr, 10)) : 8;
+    const std::uint32_t requests =
+        argc > 2 ? static_cast<std::uint32_t>(std::strtoul(argv[2], nullptr, 10)) : 20000;
+
+    const std::array<std::pair<const char *, rcs::io::profile>, 3> profiles = {{
+        {"shared", rcs::io::profile::shared},
+        {"cooperative", rcs::io::profile::cooperative},
+        {"single_issuer", rcs::io::profile::single_issuer},
+    }};
+
+    for (const auto &[name, profile] : profiles) {
+        for (const auto spin : {std::chrono::microseconds(0), std::chrono::microseconds(50)}) {
+            measure(name, {.submission = rcs::io::submission::deferred, .profile = profile, .wait = {.spin = spin}},
+                    clients, requests);
+        }
+    }
+
+    return 0;
+}
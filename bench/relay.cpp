@@ -0,0 +1,148 @@
+//
+// Loopback relay throughput and CPU time: receiving into a buffer and
+// sending it on per chunk versus splicing through pipes.
+//
+
+#include <rcs/co/awaitable.hpp>
+#include <rcs/execution/inline_executor.hpp>
+#include <rcs/io/service.hpp>
+#include <rcs/ip/address.hpp>
+#include <rcs/ip/endpoint.hpp>
+#include <rcs/ip/relay.hpp>
+#include <rcs/ip/socket.hpp>
+#include <rcs/ip/v4.hpp>
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <thread>
+#include <vector>
+
+#include <cstdint>
+
+namespace {
+
+using service_t = rcs::io::service<rcs::execution::inline_executor>;
+using socket_t  = rcs::ip::v4::tcp::socket<rcs::execution::inline_executor>;
+
+constexpr std::uint32_t CHUNK = 65536;
+
+auto listen(socket_t &listener) -> std::uint16_t {
+    listener.open();
+    listener.bind(rcs::ip::v4::endpoint(rcs::ip::v4::address::loopback(), 0));
+    listener.listen(SOMAXCONN);
+
+    struct ::sockaddr_in address = {};
+    ::socklen_t          size    = sizeof(address);
+    ::getsockname(listener.descriptor(), reinterpret_cast<struct ::sockaddr *>(&address), &size);
+    return ntohs(address.sin_port);
+}
+
+auto connect(std::uint16_t port) -> std::int32_t {
+    const rcs::ip::v4::endpoint endpoint(rcs::ip::v4::address::loopback(), port);
+
+    const std::int32_t descriptor = ::socket(AF_INET, SOCK_STREAM, 0);
+    if (::connect(descriptor, &endpoint.data(), endpoint.size()) == -1)
+        std::perror("connect");
+    return descriptor;
+}
+
+auto pump(socket_t &from, socket_t &to) -> rcs::co::awaitable<std::uint64_t> {
+    std::vector<std::uint8_t> buffer(CHUNK);
+
+    std::uint64_t bytes = 0;
+    while (true) {
+        std::uint32_t size = co_await from.recv(buffer.data(), CHUNK);
+        if (size == 0) break;
+        co_await to.sendall(buffer.data(), &size);
+        bytes += size;
+    }
+    to.shutdown(SHUT_WR);
+    co_return bytes;
+}
+
+auto copying(socket_t &listener) -> rcs::co::awaitable<std::uint64_t> {
+    socket_t a = co_await listener.accept();
+    socket_t b = co_await listener.accept();
+
+    auto forward  = pump(a, b);
+    auto backward = pump(b, a);
+    co_return co_await forward + co_await backward;
+}
+
+auto splicing(socket_t &listener) -> rcs::co::awaitable<std::uint64_t> {
+    socket_t a = co_await listener.accept();
+    socket_t b = co_await listener.accept();
+
+    const rcs::ip::traffic traffic = co_await rcs::ip::relay(a, b);
+    co_return traffic.forward + traffic.backward;
+}
+
+auto cpu() -> double {
+    struct ::timespec now = {};
+    ::clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &now);
+    return static_cast<double>(now.tv_sec) + static_cast<double>(now.tv_nsec) * 1e-9;
+}
+
+template <typename TRelay>
+void measure(const char *name, std::uint64_t total, TRelay relay) {
+    service_t           service({}, 64);
+    socket_t            listener(service);
+    const std::uint16_t port = listen(listener);
+
+    const std::int32_t source = connect(port);
+    const std::int32_t sink   = connect(port);
+
+    // Both endpoints are plain blocking sockets, whose cost is the same for
+    // either relay.
+    std::thread producer([&] {
+        std::vector<std::uint8_t> buffer(CHUNK, 'x');
+        for (std::uint64_t sent = 0; sent < total;) {
+            const ::ssize_t rv = ::send(source, buffer.data(), buffer.size(), 0);
+            if (rv <= 0) break;
+            sent += static_cast<std::uint64_t>(rv);
+        }
+        ::shutdown(source, SHUT_WR);
+    });
+    std::thread consumer([&] {
+        std::vector<std::uint8_t> buffer(CHUNK);
+        while (::recv(sink, buffer.data(), buffer.size(), 0) > 0) {}
+        ::shutdown(sink, SHUT_WR);
+    });
+
+    const double start   = cpu();
+    const auto   started = std::chrono::steady_clock::now();
+
+    const auto relayed = relay(listener);
+    service.run();
+
+    const auto   elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - started);
+    const double used    = cpu() - start;
+
+    producer.join();
+    consumer.join();
+    ::close(source);
+    ::close(sink);
+
+    relayed.rethrow_exception();
+    std::printf("%-6s %10llu B in %8.3f ms (%8.1f MiB/s), %8.3f ms CPU\n",
+                name, static_cast<unsigned long long>(relayed.result()), elapsed.count() * 1e3,
+                static_cast<double>(relayed.result()) / elapsed.count() / (1024.0 * 1024.0), used * 1e3);
+}
+
+} // namespace
+
+auto main(int argc, char **argv) -> int {
+    const std::uint64_t megabytes =
+        argc > 1 ? static_cast<std::uint64_t>(std::strtoull(argv[1], nullptr, 10)) : 1024;
+
+    measure("copy", megabytes << 20, copying);
+    measure("splice", megabytes << 20, splicing);
+
+    return 0;
+}
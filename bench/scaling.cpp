@@ -0,0 +1,135 @@
+//
+// Loopback accept and request throughput of a service pool as the number of
+// services grows. Every service accepts on a listener of its own, all bound
+// to the same port with SO_REUSEPORT.
+//
+
+#include <rcs/co/awaitable.hpp>
+#include <rcs/execution/inline_executor.hpp>
+#include <rcs/io/service_pool.hpp>
+#include <rcs/ip/address.hpp>
+#include <rcs/ip/endpoint.hpp>
+#include <rcs/ip/socket.hpp>
+#include <rcs/ip/v4.hpp>
+#include <rcs/system/affinity.hpp>
+#include <rcs/system/timeout.hpp>
+
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <cstdint>
+
+namespace {
+
+using pool_t    = rcs::io::service_pool<rcs::execution::inline_executor>;
+using service_t = pool_t::service_t;
+using socket_t  = rcs::ip::v4::tcp::socket<rcs::execution::inline_executor>;
+
+constexpr std::uint32_t MESSAGE = 64;
+
+auto session(socket_t connection) -> rcs::co::awaitable<void> {
+    std::array<char, MESSAGE> buffer = {};
+
+    while (true) {
+        std::uint32_t size = buffer.size();
+        co_await connection.recvall(buffer.data(), &size);
+        if (size != buffer.size()) co_return;
+        co_await connection.sendall(buffer.data(), &size);
+    }
+}
+
+auto serve(socket_t &listener, const std::atomic<bool> &done) -> rcs::co::awaitable<void> {
+    std::vector<rcs::co::awaitable<void>> sessions;
+
+    while (not done.load()) {
+        try {
+            sessions.push_back(session(co_await listener.accept(std::chrono::milliseconds(50))));
+        } catch (const rcs::system::timeout &) {}
+
+        std::erase_if(sessions, [](const rcs::co::awaitable<void> &s) { return s.done(); });
+    }
+}
+
+void client(std::uint16_t port, std::uint32_t connections, std::uint32_t requests) {
+    const rcs::ip::v4::endpoint endpoint(rcs::ip::v4::address::loopback(), port);
+    std::array<char, MESSAGE>   buffer = {};
+
+    for (std::uint32_t index = 0; index < connections; ++index) {
+        const std::int32_t descriptor = ::socket(AF_INET, SOCK_STREAM, 0);
+        if (::connect(descriptor, &endpoint.data(), endpoint.size()) == -1)
+            std::perror("connect");
+
+        for (std::uint32_t request = 0; request < requests; ++request) {
+            (void)::send(descriptor, buffer.data(), buffer.size(), MSG_NOSIGNAL);
+            (void)::recv(descriptor, buffer.data(), buffer.size(), MSG_WAITALL);
+        }
+
+        ::close(descriptor);
+    }
+}
+
+void measure(std::uint32_t services, std::uint32_t clients, std::uint32_t connections, std::uint32_t requests) {
+    pool_t pool(services, 256);
+
+    std::vector<std::unique_ptr<socket_t>> listeners;
+    std::uint16_t                          port = 0;
+    for (std::uint32_t index = 0; index < pool.size(); ++index) {
+        auto &listener = *listeners.emplace_back(std::make_unique<socket_t>(pool.at(index)));
+        listener.open();
+        listener.reuse_port();
+        listener.bind(rcs::ip::v4::endpoint(rcs::ip::v4::address::loopback(), port));
+        listener.listen(SOMAXCONN);
+
+        struct ::sockaddr_in address = {};
+        ::socklen_t          size    = sizeof(address);
+        ::getsockname(listener.descriptor(), reinterpret_cast<struct ::sockaddr *>(&address), &size);
+        port = ntohs(address.sin_port);
+    }
+
+    std::atomic<bool> done = false;
+    pool.start([&](service_t &, std::uint32_t index) { return serve(*listeners[index], done); });
+
+    const auto               start = std::chrono::steady_clock::now();
+    std::vector<std::thread> threads;
+    for (std::uint32_t index = 0; index < clients; ++index)
+        threads.emplace_back(client, port, connections, requests);
+    for (std::thread &thread : threads) thread.join();
+    const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start);
+
+    done.store(true);
+    pool.join();
+
+    const double accepted = static_cast<double>(clients) * connections;
+    std::printf("%3u services %10.0f conn/s %12.0f req/s\n",
+                services, accepted / elapsed.count(), accepted * requests / elapsed.count());
+}
+
+} // namespace
+
+auto main(int argc, char **argv) -> int {
+    const std::uint32_t connections =
+        argc > 1 ? static_cast<std::uint32_t>(std::strtoul(argv[1], nullptr, 10)) : 500;
+    const std::uint32_t requests =
+        argc > 2 ? static_cast<std::uint32_t>(std::strtoul(argv[2], nullptr, 10)) : 16;
+
+    const auto cpus = static_cast<std::uint32_t>(rcs::system::cpus().size());
+
+    // The clients run on as many threads as there are processors.
+    for (std::uint32_t services = 1; services <= cpus; services *= 2)
+        measure(services, cpus, connections, requests);
+    if ((cpus & (cpus - 1)) != 0) measure(cpus, cpus, connections, requests);
+
+    return 0;
+}
@@ -0,0 +1,193 @@
+#ifndef RCS_CO_GENERATOR_HPP
+#define RCS_CO_GENERATOR_HPP
+
+#include <rcs/co/awaitable.hpp>
+
+#include <coroutine> // IWYU pragma: export
+
+#include <exception>
+#include <optional>
+#include <utility>
+
+#include <cassert>
+
+namespace rcs::co {
+
+template <typename T>
+class generator;
+
+template <typename T>
+class generator_frame final {
+  public:
+    using generator_t = rcs::co::generator<T>;
+
+  public:
+    generator_frame(const generator_frame &)                     = delete;
+    generator_frame(generator_frame &&)                          = delete;
+    auto operator=(const generator_frame &) -> generator_frame & = delete;
+    auto operator=(generator_frame &&) -> generator_frame      & = delete;
+
+  public:
+    /// @brief Default constructor.
+    generator_frame() = default;
+
+    /// @brief Default destructor.
+    ~generator_frame() = default;
+
+  public:
+    /// @brief Obtain coroutine handle.
+    [[nodiscard]] auto get_return_object()
+        -> generator_frame::generator_t {
+        const typename generator_t::handle_t handle =
+            generator_t::handle_t::from_promise(*this);
+        return generator_t{handle};
+    }
+
+  public:
+    /// @brief Specifies the coroutine's behavior upon its initial invocation.
+    [[nodiscard]] auto initial_suspend() const noexcept
+        -> std::suspend_always { return {}; }
+
+    /// @brief Specifies the coroutine's behavior when it is about to complete.
+    [[nodiscard]] auto final_suspend() const noexcept
+        -> rcs::co::suspend_forward<rcs::co::generator_frame<T>> {
+        return rcs::co::suspend_forward<
+            rcs::co::generator_frame<T>>{};
+    }
+
+  public:
+    /// @brief Hand a value over to the consumer and suspend until the next
+    ///        value is requested.
+    auto yield_value(T value)
+        -> rcs::co::suspend_forward<rcs::co::generator_frame<T>> {
+        m_value = std::move(value);
+        return rcs::co::suspend_forward<
+            rcs::co::generator_frame<T>>{};
+    }
+
+    /// @brief Signal the coroutine's completion.
+    void return_void() {}
+
+    /// @brief Capture the exception thrown within the coroutine's body.
+    void unhandled_exception() { m_exception = std::current_exception(); }
+
+  public:
+    /// @brief Take the last yielded value, if any.
+    [[nodiscard]] auto take()
+        -> std::optional<T> { return std::exchange(m_value, std::nullopt); }
+
+  public:
+    /// @brief Check if the coroutine completed with an exception.
+    [[nodiscard]] auto has_exception() const
+        -> bool { return m_exception != nullptr; }
+
+    /// @brief Obtain the exception.
+    [[nodiscard]] auto exception() const
+        -> std::exception_ptr { return m_exception; }
+
+  public:
+    /// @brief Check if the coroutine is awaited by a consumer.
+    [[nodiscard]] auto has_caller() const
+        -> bool { return m_caller != nullptr; }
+
+    /// @brief Obtain the consumer coroutine.
+    [[nodiscard]] auto caller() const
+        -> std::coroutine_handle<> { return m_caller; }
+
+    /// @brief Assign the consumer coroutine.
+    void set_caller(std::coroutine_handle<> caller) {
+        m_caller = caller;
+    }
+
+  private:
+    std::optional<T>        m_value     = std::nullopt;
+    std::exception_ptr      m_exception = nullptr;
+    std::coroutine_handle<> m_caller    = nullptr;
+};
+
+///
+/// @brief   Asynchronous generator.
+///
+/// @details The coroutine body runs lazily: it is resumed whenever the next
+///          value is awaited and suspended as soon as it yields one. The body
+///          may itself await other asynchronous operations in between.
+///
+template <typename T>
+class generator final {
+  public:
+    using promise_type = rcs::co::generator_frame<T>;
+    using handle_t     = std::coroutine_handle<rcs::co::generator_frame<T>>;
+
+  public:
+    generator(const generator &)                     = delete;
+    auto operator=(const generator &) -> generator & = delete;
+
+  public:
+    /// @brief Construct from an existing generator.
+    generator(generator &&source) noexcept
+        : m_handle(std::exchange(source.m_handle, nullptr)) {}
+
+    /// @brief Construct from a coroutine handle.
+    explicit generator(const generator::handle_t &handle)
+        : m_handle(handle) {}
+
+    /// @brief Assign from an existing generator.
+    auto operator=(generator &&source) noexcept -> generator & {
+        if (m_handle) m_handle.destroy();
+        m_handle = std::exchange(source.m_handle, nullptr);
+        return *this;
+    }
+
+    /// @brief Destroy the coroutine.
+    ~generator() {
+        if (m_handle) {
+            m_handle.destroy();
+        }
+    }
+
+  public:
+    /// @brief Awaiter of the next value.
+    class next_t final {
+      public:
+        explicit next_t(generator::handle_t handle)
+            : m_handle(handle) {}
+
+      public:
+        /// @brief Check whether the generator has already completed.
+        [[nodiscard]] auto await_ready() const
+            -> bool { return m_handle.done(); }
+
+        /// @brief Resume the generator until it yields the next value.
+        auto await_suspend(std::coroutine_handle<> caller)
+            -> std::coroutine_handle<> {
+            assert(not m_handle.promise().has_caller());
+            m_handle.promise().set_caller(caller);
+            return m_handle;
+        }
+
+        /// @brief Obtain the yielded value or `std::nullopt` if the
+        ///        generator has completed.
+        auto await_resume() -> std::optional<T> {
+            const auto &promise = m_handle.promise();
+            if (promise.has_exception())
+                std::rethrow_exception(promise.exception());
+            return m_handle.promise().take();
+        }
+
+      private:
+        /// @brief Handle to the generator coroutine.
+        generator::handle_t m_handle = nullptr;
+    };
+
+    /// @brief Await the next value.
+    [[nodiscard]] auto next()
+        -> generator::next_t { return generator::next_t{m_handle}; }
+
+  private:
+    /// @brief Handle to the managed coroutine.
+    generator::handle_t m_handle = nullptr;
+};
+
+} // namespace rcs::co
+
+#endif
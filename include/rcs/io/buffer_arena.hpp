@@ -0,0 +1,92 @@
+#ifndef RCS_IO_BUFFER_ARENA_HPP
+#define RCS_IO_BUFFER_ARENA_HPP
+
+#include <rcs/io/slice.hpp>
+
+#include <mutex>
+#include <vector>
+
+#include <cstdint>
+
+namespace rcs::io {
+
+///
+/// @brief   Arena of buffers registered with an io_uring instance.
+///
+/// @details The kernel pins the pages of the registered buffers once, so
+///          that fixed operations targeting them need not pin and unpin the
+///          pages on every submission. Buffers are handed out as slices and
+///          may be given back from any thread. The arena is page-aligned, and
+///          so is every buffer whose size is a multiple of the page size,
+///          as direct file I/O requires.
+///
+class buffer_arena final {
+  public:
+    /// @brief Maximum number of buffers.
+    static constexpr std::uint32_t MAX_CAPACITY = 16384;
+
+  public:
+    buffer_arena(const buffer_arena &)                     = delete;
+    buffer_arena(buffer_arena &&)                          = delete;
+    auto operator=(const buffer_arena &) -> buffer_arena & = delete;
+    auto operator=(buffer_arena &&) -> buffer_arena      & = delete;
+
+  public:
+    ///
+    /// @brief   Allocate and register the specified number of equally sized
+    ///          buffers.
+    ///
+    /// @throws  rcs::system::exception
+    ///
+    buffer_arena(std::int32_t descriptor, std::uint32_t capacity, std::uint32_t size);
+
+    /// @brief Unregister and free the buffers.
+    ~buffer_arena();
+
+  public:
+    /// @brief Get the number of buffers.
+    [[nodiscard]] auto capacity() const -> std::uint32_t;
+
+    /// @brief Get the size of a single buffer.
+    [[nodiscard]] auto size() const -> std::uint32_t;
+
+    /// @brief Get the number of free buffers.
+    [[nodiscard]] auto available() const -> std::uint32_t;
+
+    /// @brief Get the memory of the specified buffer.
+    [[nodiscard]] auto data(std::uint16_t index) const -> std::uint8_t *;
+
+  public:
+    ///
+    /// @brief   Take a free buffer.
+    ///
+    /// @throws  rcs::system::exception
+    ///
+    [[nodiscard]] auto acquire() -> rcs::io::slice;
+
+    /// @brief Give a buffer back to the arena.
+    void release(std::uint16_t index);
+
+  private:
+    /// @brief io_uring instance identifier.
+    std::int32_t m_descriptor = -1;
+
+    /// @brief Buffer memory.
+    std::uint8_t *m_base = nullptr;
+
+    /// @brief Number of buffers.
+    std::uint32_t m_capacity = 0;
+
+    /// @brief Size of a single buffer.
+    std::uint32_t m_size = 0;
+
+    /// @brief Indices of the free buffers.
+    std::vector<std::uint16_t> m_free;
+
+    /// @brief Guards the free buffers.
+    mutable std::mutex m_mutex;
+};
+
+} // namespace rcs::io
+
+#endif
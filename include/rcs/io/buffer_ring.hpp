@@ -0,0 +1,81 @@
+#ifndef RCS_IO_BUFFER_RING_HPP
+#define RCS_IO_BUFFER_RING_HPP
+
+#include <rcs/io/lease.hpp>
+#include <rcs/io/uring/bufr.hpp>
+
+#include <atomic>
+#include <mutex>
+
+#include <cstdint>
+
+namespace rcs::io {
+
+///
+/// @brief   Group of buffers shared with the kernel.
+///
+/// @details Operations selecting buffers from the group only take a buffer
+///          once data arrives, so that idle operations hold no memory.
+///          Buffers are handed out as leases and may be given back from any
+///          thread.
+///
+class buffer_ring final {
+  public:
+    buffer_ring(const buffer_ring &)                     = delete;
+    buffer_ring(buffer_ring &&)                          = delete;
+    auto operator=(const buffer_ring &) -> buffer_ring & = delete;
+    auto operator=(buffer_ring &&) -> buffer_ring      & = delete;
+
+  public:
+    ///
+    /// @brief   Construct and register a buffer ring.
+    ///
+    /// @throws  rcs::system::exception
+    ///
+    buffer_ring(std::int32_t  descriptor,
+                std::uint16_t group,
+                std::uint32_t capacity,
+                std::uint32_t size);
+
+    /// @brief Default destructor.
+    ~buffer_ring() = default;
+
+  public:
+    /// @brief Get the buffer group identifier.
+    [[nodiscard]] auto group() const -> std::uint16_t;
+
+    /// @brief Get the number of buffers.
+    [[nodiscard]] auto capacity() const -> std::uint32_t;
+
+    /// @brief Get the size of a single buffer.
+    [[nodiscard]] auto size() const -> std::uint32_t;
+
+    /// @brief Get the memory of the specified buffer.
+    [[nodiscard]] auto data(std::uint16_t index) const -> std::uint8_t *;
+
+    /// @brief Get the number of buffers leased and not yet handed back.
+    [[nodiscard]] auto leased() const -> std::uint32_t;
+
+  public:
+    /// @brief Lease a buffer the kernel has picked and filled with the
+    ///        specified number of bytes.
+    [[nodiscard]] auto lease(std::uint16_t index, std::uint32_t size)
+        -> rcs::io::lease;
+
+    /// @brief Hand a leased buffer back to the kernel.
+    void release(std::uint16_t index);
+
+  private:
+    /// @brief Underlying ring.
+    rcs::io::uring::bufr m_ring;
+
+    /// @brief Guards the ring tail.
+    std::mutex m_mutex;
+
+    /// @brief Number of buffers leased and not yet handed back.
+    std::atomic<std::uint32_t> m_leased = {0};
+};
+
+} // namespace rcs::io
+
+#endif
@@ -0,0 +1,75 @@
+#ifndef RCS_IO_CANCELLATION_HPP
+#define RCS_IO_CANCELLATION_HPP
+
+#include <mutex>
+
+#include <cstdint>
+
+namespace rcs::io {
+
+///
+/// @brief   Handle through which a pending operation can be cancelled.
+///
+/// @details An operation attaches its token to the handle for as long as it
+///          is pending. Cancelling the handle requests the kernel to cancel
+///          the attached operation, which then completes with -ECANCELED.
+///          A cancellation requested while no operation is attached is
+///          applied to the next operation attached to the handle, which
+///          checks for it once it has been initiated.
+///
+class cancellation final {
+  public:
+    /// @brief Function requesting cancellation of the operation carrying a
+    ///        token.
+    using function_t = void (*)(void *context, std::uint64_t token);
+
+  public:
+    cancellation(const cancellation &)                     = delete;
+    cancellation(cancellation &&)                          = delete;
+    auto operator=(const cancellation &) -> cancellation & = delete;
+    auto operator=(cancellation &&) -> cancellation      & = delete;
+
+  public:
+    /// @brief Construct a handle with no operation attached.
+    cancellation() = default;
+
+    /// @brief Default destructor.
+    ~cancellation() = default;
+
+  public:
+    /// @brief Check whether cancellation has been requested.
+    [[nodiscard]] auto requested() const -> bool;
+
+    /// @brief Request cancellation of the attached operation.
+    void cancel();
+
+    /// @brief Forget a previously requested cancellation.
+    void reset();
+
+  public:
+    /// @brief Attach an operation about to be initiated.
+    void attach(cancellation::function_t function, void *context, std::uint64_t token);
+
+    /// @brief Detach the pending operation.
+    void detach();
+
+  private:
+    /// @brief Cancellation function of the attached operation.
+    cancellation::function_t m_function = nullptr;
+
+    /// @brief Context of the cancellation function.
+    void *m_context = nullptr;
+
+    /// @brief Token of the attached operation.
+    std::uint64_t m_token = 0;
+
+    /// @brief Whether cancellation has been requested.
+    bool m_requested = false;
+
+    /// @brief Guards the handle.
+    mutable std::mutex m_mutex;
+};
+
+} // namespace rcs::io
+
+#endif
@@ -0,0 +1,109 @@
+#ifndef RCS_IO_CAPABILITIES_HPP
+#define RCS_IO_CAPABILITIES_HPP
+
+#include <rcs/io/uring/op.hpp>
+#include <rcs/io/uring/params.hpp>
+
+#include <bitset>
+
+#include <cstdint>
+
+namespace rcs::io {
+
+///
+/// @brief   Capabilities of the running kernel.
+///
+/// @details Probed once per io_uring instance, so that optional fast paths
+///          can be chosen at runtime and fall back on kernels lacking them.
+///          If the kernel cannot be probed for opcodes, none are reported
+///          as supported.
+///
+class capabilities final {
+  public:
+    /// @brief Construct an empty capability set.
+    capabilities() = default;
+
+    ///
+    /// @brief   Probe an io_uring instance set up with the specified
+    ///          parameters.
+    ///
+    /// @throws  rcs::system::exception
+    ///
+    capabilities(std::int32_t descriptor, const rcs::io::uring::params &params);
+
+  public:
+    /// @brief Check whether the kernel supports an opcode.
+    [[nodiscard]] auto supports(rcs::io::uring::op opcode) const -> bool;
+
+    /// @brief Get the feature flags reported by the kernel.
+    [[nodiscard]] auto features() const -> std::uint32_t;
+
+    /// @brief Get the flags the io_uring instance has been set up with.
+    [[nodiscard]] auto setup() const -> std::uint32_t;
+
+  public:
+    /// @brief Check whether waits for completions can time out in the kernel.
+    [[nodiscard]] auto timed_wait() const -> bool;
+
+    ///
+    /// @brief   Check whether a single submission can keep accepting
+    ///          connections.
+    ///
+    /// @details The probe does not cover operation flags; multishot accept
+    ///          arrived along with IORING_OP_SOCKET, which stands in for it.
+    ///
+    [[nodiscard]] auto multishot() const -> bool;
+
+    ///
+    /// @brief   Check whether a single submission can keep receiving.
+    ///
+    /// @details Multishot receives arrived after multishot accept, along with
+    ///          IORING_OP_SEND_ZC, which stands in for them.
+    ///
+    [[nodiscard]] auto multishot_recv() const -> bool;
+
+    ///
+    /// @brief   Check whether rings of buffers can be provided.
+    ///
+    /// @details Arrived along with multishot accept.
+    ///
+    [[nodiscard]] auto buffer_rings() const -> bool;
+
+    /// @brief Check whether successful operations can be kept from posting
+    ///        completion queue events.
+    [[nodiscard]] auto skip_success() const -> bool;
+
+    /// @brief Check whether sends can avoid copying the buffer.
+    [[nodiscard]] auto zerocopy() const -> bool;
+
+    /// @brief Check whether the submission queue is indexed directly,
+    ///        without the indirection array.
+    [[nodiscard]] auto no_sqarray() const -> bool;
+
+    ///
+    /// @brief   Check whether a ring can be messaged without a ring of one's
+    ///          own.
+    ///
+    /// @details Probed by messaging an invalid descriptor, which only
+    ///          kernels lacking the registration opcode reject as an invalid
+    ///          argument.
+    ///
+    [[nodiscard]] auto direct_messages() const -> bool;
+
+  private:
+    /// @brief Supported opcodes.
+    std::bitset<256> m_ops;
+
+    /// @brief Feature flags.
+    std::uint32_t m_features = 0;
+
+    /// @brief Setup flags.
+    std::uint32_t m_setup = 0;
+
+    /// @brief Whether rings can be messaged without a ring.
+    bool m_messages = false;
+};
+
+} // namespace rcs::io
+
+#endif
@@ -0,0 +1,50 @@
+#ifndef RCS_IO_COMPLETION_HPP
+#define RCS_IO_COMPLETION_HPP
+
+#include <cstdint>
+
+namespace rcs::io {
+
+///
+/// @brief   Asynchronous completion handler.
+///
+/// @details The token of every submission queue entry refers to an object
+///          of this type. The event processing loop invokes the handler
+///          once for every completion queue event carrying that token,
+///          which allows a single submission to produce multiple events.
+///
+class completion {
+  public:
+    /// @brief Handler function type.
+    using function_t = void (*)(rcs::io::completion *self,
+                                std::int32_t          result,
+                                std::uint32_t         flags);
+
+  public:
+    completion(const completion &)                     = delete;
+    completion(completion &&)                          = delete;
+    auto operator=(const completion &) -> completion & = delete;
+    auto operator=(completion &&) -> completion      & = delete;
+
+  public:
+    /// @brief Construct from a handler function.
+    explicit completion(completion::function_t function)
+        : m_function(function) {}
+
+    /// @brief Default destructor.
+    ~completion() = default;
+
+  public:
+    /// @brief Handle a completion queue event.
+    void complete(std::int32_t result, std::uint32_t flags) {
+        m_function(this, result, flags);
+    }
+
+  private:
+    /// @brief Handler function.
+    completion::function_t m_function = nullptr;
+};
+
+} // namespace rcs::io
+
+#endif
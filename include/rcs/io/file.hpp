@@ -0,0 +1,274 @@
+#ifndef RCS_IO_FILE_HPP
+#define RCS_IO_FILE_HPP
+
+#include <rcs/co/awaitable.hpp>
+
+#include <rcs/execution/executor.hpp>
+#include <rcs/execution/inline_executor.hpp>
+
+#include <rcs/system/exception.hpp>
+#include <rcs/system/handle.hpp>
+
+#include <rcs/io/buffer_arena.hpp>
+#include <rcs/io/service.hpp>
+#include <rcs/io/slice.hpp>
+#include <rcs/io/uring/flags.hpp>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <string>
+#include <utility>
+
+#include <cassert>
+#include <cerrno>
+#include <cstdint>
+
+namespace rcs::io {
+
+///
+/// @brief   File accessed through an asynchronous I/O service.
+///
+/// @details Every operation, opening and closing included, runs in the
+///          kernel, so that the thread running the event processing loop
+///          never blocks on the storage device. Reads and writes are
+///          positional and do not move a file offset.
+///
+///          A file opened with O_DIRECT bypasses the page cache. Its
+///          transfers must then be aligned to alignment(), both in memory
+///          and in the file; the buffers handed out by acquire() are, since
+///          they come from the page-aligned buffer arena registered with the
+///          service.
+///
+template <rcs::execution::executor TExecutorType>
+class file final {
+  public:
+    /// @brief Executor type.
+    using executor_t = TExecutorType;
+
+    /// @brief Service type.
+    using service_t = rcs::io::service<file::executor_t>;
+
+  public:
+    /// @brief Alignment assumed for direct transfers if the kernel does not
+    ///        report it.
+    static constexpr std::uint32_t DEFAULT_ALIGNMENT = 4096;
+
+  public:
+    file(const file &)                     = delete;
+    auto operator=(const file &) -> file & = delete;
+
+  public:
+    /// @brief Construct from an existing file.
+    file(file &&) = default;
+
+    /// @brief Assign from an existing file.
+    auto operator=(file &&) -> file & = default;
+
+    /// @brief Construct a closed file.
+    explicit file(file::service_t &service)
+        : m_service(&service) {}
+
+    /// @brief Close the file right away, unless it has been closed already.
+    ~file() = default;
+
+  public:
+    /// @brief Get the file descriptor.
+    auto descriptor() const
+        -> std::int32_t { return m_handle.descriptor(); }
+
+    /// @brief Check whether the file bypasses the page cache.
+    auto direct() const
+        -> bool { return m_direct; }
+
+    /// @brief Get the alignment of direct transfers.
+    auto alignment() const
+        -> std::uint32_t { return m_alignment; }
+
+  public:
+    ///
+    /// @brief   Open the file at the specified path.
+    ///
+    /// @details Direct files query the alignment they require once opened.
+    ///
+    /// @throws  rcs::system::exception
+    ///
+    auto open(std::string path, std::uint32_t oflags, std::uint32_t mode = 0644)
+        -> rcs::co::awaitable<void> {
+        assert(m_handle.descriptor() == -1);
+
+        std::int32_t rv = co_await m_service->openat(AT_FDCWD, path.c_str(), oflags | O_CLOEXEC, mode);
+        if (rv < 0) throw rcs::system::exception(-rv);
+        m_handle = rv;
+        m_direct = (oflags & O_DIRECT) != 0;
+
+        if (m_direct) m_alignment = co_await file::_alignment();
+    }
+
+    ///
+    /// @brief   Close the file.
+    ///
+    /// @details The descriptor is given up right away, even if closing it
+    ///          fails.
+    ///
+    /// @throws  rcs::system::exception
+    ///
+    auto close()
+        -> rcs::co::awaitable<void> {
+        if (-1 == m_handle.descriptor()) co_return;
+
+        std::int32_t rv = co_await m_service->close(m_handle.release());
+        if (rv < 0) throw rcs::system::exception(-rv);
+    }
+
+  public:
+    ///
+    /// @brief   Get the status of the file.
+    ///
+    /// @details `mask` selects the STATX_* fields to be filled in.
+    ///
+    /// @throws  rcs::system::exception
+    ///
+    auto stat(std::uint32_t mask = STATX_BASIC_STATS)
+        -> rcs::co::awaitable<struct ::statx> {
+        struct ::statx status = {};
+
+        std::int32_t rv = co_await m_service->statx(m_handle.descriptor(), "", AT_EMPTY_PATH, mask, status);
+        if (rv < 0) throw rcs::system::exception(-rv);
+        co_return status;
+    }
+
+    /// @brief Get the size of the file in bytes.
+    auto size()
+        -> rcs::co::awaitable<std::uint64_t> {
+        const struct ::statx status = co_await file::stat(STATX_SIZE);
+        co_return status.stx_size;
+    }
+
+    /// @brief Flush the data and metadata of the file to the storage device.
+    auto sync()
+        -> rcs::co::awaitable<void> {
+        std::int32_t rv = co_await m_service->fsync(m_handle.descriptor());
+        if (rv < 0) throw rcs::system::exception(-rv);
+    }
+
+    /// @brief Flush the data of the file to the storage device, along with
+    ///        the metadata needed to retrieve it.
+    auto datasync()
+        -> rcs::co::awaitable<void> {
+        std::int32_t rv = co_await m_service->fsync(m_handle.descriptor(), rcs::io::uring::FSYNC_DATASYNC);
+        if (rv < 0) throw rcs::system::exception(-rv);
+    }
+
+    ///
+    /// @brief   Allocate storage for a range of the file.
+    ///
+    /// @details `mode` takes the FALLOC_FL_* flags; by default, the file
+    ///          grows if the range extends past its end.
+    ///
+    /// @throws  rcs::system::exception
+    ///
+    auto allocate(std::uint64_t offset, std::uint64_t length, std::uint32_t mode = 0)
+        -> rcs::co::awaitable<void> {
+        std::int32_t rv = co_await m_service->fallocate(m_handle.descriptor(), mode, offset, length);
+        if (rv < 0) throw rcs::system::exception(-rv);
+    }
+
+  public:
+    /// @brief Read at most the specified number of bytes at an offset.
+    auto read(void *buf, std::uint32_t bufsize, std::uint64_t offset)
+        -> rcs::co::awaitable<std::uint32_t> {
+        assert(file::_aligned(buf, bufsize, offset));
+
+        std::int32_t rv = co_await m_service->read(m_handle.descriptor(), buf, bufsize, offset);
+        if (rv < 0) throw rcs::system::exception(-rv);
+        co_return rv;
+    }
+
+    /// @brief Write at most the specified number of bytes at an offset.
+    auto write(const void *buf, std::uint32_t bufsize, std::uint64_t offset)
+        -> rcs::co::awaitable<std::uint32_t> {
+        assert(file::_aligned(buf, bufsize, offset));
+
+        std::int32_t rv = co_await m_service->write(m_handle.descriptor(), buf, bufsize, offset);
+        if (rv < 0) throw rcs::system::exception(-rv);
+        co_return rv;
+    }
+
+  public:
+    ///
+    /// @brief   Take a buffer from the arena registered with the service.
+    ///
+    /// @details The buffer is suitably aligned for direct transfers as long
+    ///          as the arena buffer size is a multiple of alignment().
+    ///
+    /// @throws  rcs::system::exception
+    ///
+    auto acquire() -> rcs::io::slice {
+        rcs::io::buffer_arena *arena = m_service->buffers();
+        if (arena == nullptr) throw rcs::system::exception(ENOBUFS);
+        if (m_direct and arena->size() % m_alignment != 0) throw rcs::system::exception(EINVAL);
+        return arena->acquire();
+    }
+
+    /// @brief Read at most the specified number of bytes at an offset into
+    ///        a registered buffer.
+    auto read(const rcs::io::slice &slice, std::uint32_t bufsize, std::uint64_t offset)
+        -> rcs::co::awaitable<std::uint32_t> {
+        assert(file::_aligned(slice.data(), bufsize, offset));
+
+        std::int32_t rv = co_await m_service->read_fixed(m_handle.descriptor(), slice, bufsize, offset);
+        if (rv < 0) throw rcs::system::exception(-rv);
+        co_return rv;
+    }
+
+    /// @brief Write at most the specified number of bytes at an offset from
+    ///        a registered buffer.
+    auto write(const rcs::io::slice &slice, std::uint32_t bufsize, std::uint64_t offset)
+        -> rcs::co::awaitable<std::uint32_t> {
+        assert(file::_aligned(slice.data(), bufsize, offset));
+
+        std::int32_t rv = co_await m_service->write_fixed(m_handle.descriptor(), slice, bufsize, offset);
+        if (rv < 0) throw rcs::system::exception(-rv);
+        co_return rv;
+    }
+
+  private:
+    /// @brief Query the alignment of direct transfers.
+    auto _alignment()
+        -> rcs::co::awaitable<std::uint32_t> {
+#ifdef STATX_DIOALIGN
+        const struct ::statx status = co_await file::stat(STATX_DIOALIGN);
+        if ((status.stx_mask & STATX_DIOALIGN) != 0 and status.stx_dio_offset_align != 0)
+            co_return std::max(status.stx_dio_mem_align, status.stx_dio_offset_align);
+#endif
+        co_return file::DEFAULT_ALIGNMENT;
+    }
+
+    /// @brief Check whether a transfer satisfies the alignment of the file.
+    auto _aligned(const void *buf, std::uint32_t bufsize, std::uint64_t offset) const -> bool {
+        if (not m_direct) return true;
+        return reinterpret_cast<std::uintptr_t>(buf) % m_alignment == 0 and bufsize % m_alignment == 0 and
+               offset % m_alignment == 0;
+    }
+
+  private:
+    /// @brief I/O service.
+    file::service_t *m_service = nullptr;
+
+    /// @brief File descriptor.
+    rcs::system::handle m_handle = -1;
+
+    /// @brief Whether the file bypasses the page cache.
+    bool m_direct = false;
+
+    /// @brief Alignment of direct transfers.
+    std::uint32_t m_alignment = 1;
+};
+
+} // namespace rcs::io
+
+template class rcs::io::file<rcs::execution::inline_executor>;
+
+#endif
@@ -0,0 +1,82 @@
+#ifndef RCS_IO_FILE_TABLE_HPP
+#define RCS_IO_FILE_TABLE_HPP
+
+#include <rcs/io/slot.hpp>
+
+#include <mutex>
+#include <vector>
+
+#include <cstdint>
+
+namespace rcs::io {
+
+///
+/// @brief   Table of files registered with an io_uring instance.
+///
+/// @details Operations referring to a registered file by its slot index
+///          spare the kernel from looking the descriptor up and taking a
+///          reference on every submission. The table is registered sparse;
+///          slots are populated and cleared one at a time as descriptors
+///          are acquired and released.
+///
+class file_table final {
+  public:
+    file_table(const file_table &)                     = delete;
+    file_table(file_table &&)                          = delete;
+    auto operator=(const file_table &) -> file_table & = delete;
+    auto operator=(file_table &&) -> file_table      & = delete;
+
+  public:
+    ///
+    /// @brief   Register a sparse table of files.
+    ///
+    /// @throws  rcs::system::exception
+    ///
+    file_table(std::int32_t descriptor, std::uint32_t capacity);
+
+    /// @brief Unregister the table.
+    ~file_table();
+
+  public:
+    /// @brief Get the number of slots.
+    [[nodiscard]] auto capacity() const -> std::uint32_t;
+
+    /// @brief Get the number of free slots.
+    [[nodiscard]] auto available() const -> std::uint32_t;
+
+  public:
+    ///
+    /// @brief   Register a descriptor in a free slot.
+    ///
+    /// @details The kernel holds its own reference to the file until the
+    ///          slot is released, so the slot should be released before the
+    ///          descriptor is closed.
+    ///
+    /// @throws  rcs::system::exception
+    ///
+    [[nodiscard]] auto acquire(std::int32_t descriptor) -> rcs::io::slot;
+
+    /// @brief Clear a slot and make it available for reuse.
+    void release(std::uint32_t index);
+
+  private:
+    /// @brief Replace the file registered in a slot.
+    void _update(std::uint32_t index, std::int32_t descriptor) const;
+
+  private:
+    /// @brief io_uring instance identifier.
+    std::int32_t m_descriptor = -1;
+
+    /// @brief Number of slots.
+    std::uint32_t m_capacity = 0;
+
+    /// @brief Indices of the free slots.
+    std::vector<std::uint32_t> m_free;
+
+    /// @brief Guards the free slots.
+    mutable std::mutex m_mutex;
+};
+
+} // namespace rcs::io
+
+#endif
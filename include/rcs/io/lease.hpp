@@ -0,0 +1,68 @@
+#ifndef RCS_IO_LEASE_HPP
+#define RCS_IO_LEASE_HPP
+
+#include <cstdint>
+
+namespace rcs::io {
+
+class buffer_ring;
+
+///
+/// @brief   Buffer leased from a buffer ring.
+///
+/// @details Refers to a buffer the kernel has filled with received data.
+///          The buffer is handed back to its ring once the lease is released
+///          or destroyed.
+///
+class lease final {
+  public:
+    lease(const lease &)                     = delete;
+    auto operator=(const lease &) -> lease & = delete;
+
+  public:
+    /// @brief Construct from an existing lease.
+    lease(lease &&other) noexcept;
+
+    /// @brief Release the current buffer and take over another lease.
+    auto operator=(lease &&other) noexcept -> lease &;
+
+    /// @brief Lease a buffer of a buffer ring.
+    lease(rcs::io::buffer_ring *ring, std::uint16_t index, std::uint32_t size);
+
+    /// @brief Construct an empty lease.
+    lease() = default;
+
+    /// @brief Release the buffer.
+    ~lease();
+
+  public:
+    /// @brief Check whether the lease refers to no buffer.
+    [[nodiscard]] auto empty() const -> bool;
+
+    /// @brief Get the buffer memory.
+    [[nodiscard]] auto data() const -> std::uint8_t *;
+
+    /// @brief Get the number of bytes stored in the buffer.
+    [[nodiscard]] auto size() const -> std::uint32_t;
+
+    /// @brief Get the buffer index within its ring.
+    [[nodiscard]] auto index() const -> std::uint16_t;
+
+  public:
+    /// @brief Hand the buffer back to its ring.
+    void release();
+
+  private:
+    /// @brief Buffer ring the buffer belongs to.
+    rcs::io::buffer_ring *m_ring = nullptr;
+
+    /// @brief Buffer index.
+    std::uint16_t m_index = 0;
+
+    /// @brief Number of bytes stored in the buffer.
+    std::uint32_t m_size = 0;
+};
+
+} // namespace rcs::io
+
+#endif
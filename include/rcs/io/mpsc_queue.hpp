@@ -0,0 +1,102 @@
+#ifndef RCS_IO_MPSC_QUEUE_HPP
+#define RCS_IO_MPSC_QUEUE_HPP
+
+#include <atomic>
+
+#include <cstdint>
+
+namespace rcs::io {
+
+///
+/// @brief   Intrusive multi-producer single-consumer queue.
+///
+/// @details Producers push nodes with a single atomic exchange and never
+///          wait for one another or for the consumer. Nodes are linked
+///          through their `next` member and must stay alive until popped.
+///          Only one thread at a time may pop.
+///
+template <typename TNodeType>
+class mpsc_queue final {
+  public:
+    mpsc_queue(const mpsc_queue &)                     = delete;
+    mpsc_queue(mpsc_queue &&)                          = delete;
+    auto operator=(const mpsc_queue &) -> mpsc_queue & = delete;
+    auto operator=(mpsc_queue &&) -> mpsc_queue      & = delete;
+
+  public:
+    /// @brief Construct an empty queue.
+    mpsc_queue() = default;
+
+    /// @brief Default destructor.
+    ~mpsc_queue() = default;
+
+  public:
+    /// @brief Get the number of nodes pushed but not yet popped.
+    [[nodiscard]] auto size() const -> std::uint32_t { return m_size.load(); }
+
+    /// @brief Push a node.
+    void push(TNodeType *node) {
+        m_size.fetch_add(1);
+        mpsc_queue::_link(node);
+    }
+
+    ///
+    /// @brief   Pop the oldest node.
+    ///
+    /// @return  Returns `nullptr` if the queue is empty, or if the oldest
+    ///          node is still being linked by its producer, in which case it
+    ///          shows up shortly.
+    ///
+    auto pop() -> TNodeType * {
+        TNodeType *tail = m_tail;
+        TNodeType *next = tail->next.load(std::memory_order::acquire);
+
+        // Skip the stub.
+        if (tail == &m_stub) {
+            if (next == nullptr) return nullptr;
+            m_tail = next;
+            tail   = next;
+            next   = next->next.load(std::memory_order::acquire);
+        }
+
+        if (next == nullptr) {
+            // A producer is in the middle of linking a node after the tail.
+            if (tail != m_head.load(std::memory_order::acquire)) return nullptr;
+
+            // The tail is the last node; put the stub behind it, so that the
+            // tail can be detached.
+            mpsc_queue::_link(&m_stub);
+            next = tail->next.load(std::memory_order::acquire);
+            if (next == nullptr) return nullptr;
+        }
+
+        m_tail = next;
+        m_size.fetch_sub(1);
+        return tail;
+    }
+
+  private:
+    /// @brief Link a node after the head.
+    void _link(TNodeType *node) {
+        node->next.store(nullptr, std::memory_order::relaxed);
+        TNodeType *prev = m_head.exchange(node, std::memory_order::acq_rel);
+        prev->next.store(node, std::memory_order::release);
+    }
+
+  private:
+    /// @brief Placeholder node keeping the queue non-empty.
+    TNodeType m_stub = {};
+
+    /// @brief Most recently pushed node.
+    std::atomic<TNodeType *> m_head = &m_stub;
+
+    /// @brief Oldest node, owned by the consumer.
+    TNodeType *m_tail = &m_stub;
+
+    /// @brief Number of nodes pushed but not yet popped.
+    std::atomic<std::uint32_t> m_size = {0};
+};
+
+} // namespace rcs::io
+
+#endif
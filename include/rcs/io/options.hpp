@@ -0,0 +1,100 @@
+#ifndef RCS_IO_OPTIONS_HPP
+#define RCS_IO_OPTIONS_HPP
+
+#include <chrono>
+
+#include <cstdint>
+
+namespace rcs::io {
+
+/// @brief Specifies when initiated operations are handed over to the kernel.
+enum class submission : std::uint8_t {
+    /// @details Every operation is submitted as soon as it is initiated.
+    immediate = 0,
+
+    /// @details Operations are only staged in the submission queue. The event
+    ///          processing loop submits all staged entries at once and waits
+    ///          for completions within the same system call.
+    deferred = 1,
+};
+
+///
+/// @brief   Specifies how the ring is set up with regard to the threads
+///          using it.
+///
+/// @details Profiles the running kernel does not support fall back to
+///          `shared`.
+///
+enum class profile : std::uint8_t {
+    /// @details Any thread may initiate operations and run the event
+    ///          processing loop.
+    shared = 0,
+
+    /// @details Like `shared`, but completions are posted once the thread
+    ///          running the loop enters the kernel, instead of interrupting
+    ///          it as they arrive.
+    cooperative = 1,
+
+    /// @details A single thread drives the ring: the first one to run the
+    ///          event processing loop. Only that thread submits, and it
+    ///          enters the kernel through a registered ring descriptor;
+    ///          completions are posted once it waits for them. Submission is
+    ///          deferred to the loop, so that operations may still be
+    ///          initiated from other threads, but resources must be
+    ///          registered before the loop first runs, or from its thread.
+    single_issuer = 2,
+};
+
+///
+/// @brief   Kernel-side submission queue polling options.
+///
+/// @details A kernel thread picks up the published entries, so that
+///          submission takes no system call unless the thread has been idle
+///          long enough to go to sleep. Dedicates a core to the service.
+///
+struct sqpoll final {
+    /// @brief Whether the submission queue is polled by a kernel thread.
+    bool enabled = false;
+
+    /// @brief Number of milliseconds the thread stays awake without work.
+    std::uint32_t idle = 1000;
+
+    /// @brief CPU the thread is bound to, or -1 to leave it unbound.
+    std::int32_t cpu = -1;
+};
+
+///
+/// @brief   Completion waiting policy.
+///
+/// @details Once the completion queue runs empty, the event processing loop
+///          polls it for a while before blocking in the kernel, which saves
+///          a system call and a context switch whenever a completion arrives
+///          in time, at the expense of processor time.
+///
+struct wait_policy final {
+    /// @brief Time spent polling the completion queue before blocking.
+    std::chrono::nanoseconds spin = std::chrono::nanoseconds::zero();
+};
+
+/// @brief Asynchronous I/O service options.
+struct options final {
+    /// @brief Submission strategy.
+    rcs::io::submission submission = rcs::io::submission::immediate;
+
+    /// @brief Ring setup profile.
+    rcs::io::profile profile = rcs::io::profile::shared;
+
+    /// @brief Submission queue polling.
+    rcs::io::sqpoll sqpoll = {};
+
+    /// @brief Completion waiting.
+    rcs::io::wait_policy wait = {};
+
+    /// @brief Minimum number of bytes worth sending without copying them.
+    ///        Smaller payloads are cheaper to copy than to pin.
+    std::uint32_t zerocopy_threshold = 16384;
+};
+
+} // namespace rcs::io
+
+#endif
@@ -0,0 +1,75 @@
+#ifndef RCS_IO_PIPE_HPP
+#define RCS_IO_PIPE_HPP
+
+#include <cstdint>
+
+namespace rcs::io {
+
+class pipe_pool;
+
+///
+/// @brief   Pipe taken from a pipe pool.
+///
+/// @details Data spliced between two descriptors passes through a pipe,
+///          which must be empty once the pipe is given back. The pipe is
+///          given back to its pool once released or destroyed; a pipe that
+///          may still hold data must be discarded instead.
+///
+class pipe final {
+  public:
+    pipe(const pipe &)                     = delete;
+    auto operator=(const pipe &) -> pipe & = delete;
+
+  public:
+    /// @brief Construct from an existing pipe.
+    pipe(pipe &&other) noexcept;
+
+    /// @brief Release the current pipe and take over another one.
+    auto operator=(pipe &&other) noexcept -> pipe &;
+
+    /// @brief Take a pipe of a pool.
+    pipe(rcs::io::pipe_pool *pool, std::int32_t in, std::int32_t out, std::uint32_t capacity);
+
+    /// @brief Construct an empty pipe.
+    pipe() = default;
+
+    /// @brief Release the pipe.
+    ~pipe();
+
+  public:
+    /// @brief Check whether the object refers to no pipe.
+    [[nodiscard]] auto empty() const -> bool;
+
+    /// @brief Get the read end of the pipe.
+    [[nodiscard]] auto in() const -> std::int32_t;
+
+    /// @brief Get the write end of the pipe.
+    [[nodiscard]] auto out() const -> std::int32_t;
+
+    /// @brief Get the number of bytes the pipe can hold.
+    [[nodiscard]] auto capacity() const -> std::uint32_t;
+
+  public:
+    /// @brief Give the pipe back to its pool.
+    void release();
+
+    /// @brief Close the pipe instead of giving it back to its pool.
+    void discard();
+
+  private:
+    /// @brief Pipe pool the pipe belongs to.
+    rcs::io::pipe_pool *m_pool = nullptr;
+
+    /// @brief Read end.
+    std::int32_t m_in = -1;
+
+    /// @brief Write end.
+    std::int32_t m_out = -1;
+
+    /// @brief Number of bytes the pipe can hold.
+    std::uint32_t m_capacity = 0;
+};
+
+} // namespace rcs::io
+
+#endif
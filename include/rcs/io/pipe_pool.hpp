@@ -0,0 +1,85 @@
+#ifndef RCS_IO_PIPE_POOL_HPP
+#define RCS_IO_PIPE_POOL_HPP
+
+#include <rcs/io/pipe.hpp>
+
+#include <mutex>
+#include <vector>
+
+#include <cstdint>
+
+namespace rcs::io {
+
+///
+/// @brief   Pool of pipes to splice data through.
+///
+/// @details Creating a pipe takes two system calls, and resizing it a third
+///          one, so that pipes given back are kept for the next transfer.
+///          Pipes are created on demand; beyond the idle limit, the ones
+///          given back are closed. Pipes may be taken and given back from
+///          any thread.
+///
+class pipe_pool final {
+  public:
+    /// @brief Default number of bytes requested for every pipe.
+    static constexpr std::uint32_t DEFAULT_CAPACITY = 1U << 20;
+
+    /// @brief Default maximum number of idle pipes.
+    static constexpr std::uint32_t DEFAULT_IDLE = 16;
+
+  public:
+    pipe_pool(const pipe_pool &)                     = delete;
+    pipe_pool(pipe_pool &&)                          = delete;
+    auto operator=(const pipe_pool &) -> pipe_pool & = delete;
+    auto operator=(pipe_pool &&) -> pipe_pool      & = delete;
+
+  public:
+    ///
+    /// @brief   Construct an empty pool.
+    ///
+    /// @details Pipes are resized to `capacity` bytes, or left at their
+    ///          default size if the system limit does not allow it.
+    ///
+    explicit pipe_pool(std::uint32_t capacity = DEFAULT_CAPACITY, std::uint32_t idle = DEFAULT_IDLE);
+
+    /// @brief Close the idle pipes.
+    ~pipe_pool();
+
+  public:
+    /// @brief Get the number of idle pipes.
+    [[nodiscard]] auto idle() const -> std::uint32_t;
+
+  public:
+    ///
+    /// @brief   Take an idle pipe, or create one if there is none.
+    ///
+    /// @throws  rcs::system::exception
+    ///
+    [[nodiscard]] auto acquire() -> rcs::io::pipe;
+
+    /// @brief Give a pipe back to the pool.
+    void release(std::int32_t in, std::int32_t out, std::uint32_t capacity);
+
+  private:
+    struct entry_t {
+        std::int32_t  in       = -1;
+        std::int32_t  out      = -1;
+        std::uint32_t capacity = 0;
+    };
+
+    /// @brief Number of bytes requested for every pipe.
+    std::uint32_t m_capacity = 0;
+
+    /// @brief Maximum number of idle pipes.
+    std::uint32_t m_limit = 0;
+
+    /// @brief Idle pipes.
+    std::vector<struct entry_t> m_idle;
+
+    /// @brief Guards the idle pipes.
+    mutable std::mutex m_mutex;
+};
+
+} // namespace rcs::io
+
+#endif
@@ -6,27 +6,64 @@
 #include <rcs/execution/executor.hpp>
 #include <rcs/execution/inline_executor.hpp>
 
+#include <rcs/io/buffer_arena.hpp>
+#include <rcs/io/buffer_ring.hpp>
+#include <rcs/io/cancellation.hpp>
+#include <rcs/io/capabilities.hpp>
+#include <rcs/io/completion.hpp>
+#include <rcs/io/file_table.hpp>
+#include <rcs/io/lease.hpp>
+#include <rcs/io/mpsc_queue.hpp>
+#include <rcs/io/options.hpp>
+#include <rcs/io/pipe_pool.hpp>
+#include <rcs/io/slice.hpp>
+#include <rcs/io/stats.hpp>
 #include <rcs/io/token.hpp>
 #include <rcs/io/uring/cqe.hpp>
 #include <rcs/io/uring/cqr.hpp>
+#include <rcs/io/uring/enter.hpp>
 #include <rcs/io/uring/flags.hpp>
+#include <rcs/io/uring/getevents_arg.hpp>
+#include <rcs/io/uring/msg_ring.hpp>
 #include <rcs/io/uring/op.hpp>
 #include <rcs/io/uring/params.hpp>
+#include <rcs/io/uring/reg.hpp>
+#include <rcs/io/uring/register.hpp>
 #include <rcs/io/uring/setup.hpp>
 #include <rcs/io/uring/sqe.hpp>
 #include <rcs/io/uring/sqr.hpp>
+#include <rcs/io/uring/timespec.hpp>
 
+#include <rcs/system/exception.hpp>
 #include <rcs/system/handle.hpp>
 
+#include <poll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
 #include <atomic>
+#include <chrono>
+#include <coroutine>
+#include <deque>
+#include <functional>
 #include <memory>
 #include <mutex>
+#include <optional>
+#include <span>
+#include <thread>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <cassert>
+#include <cerrno>
 #include <cstdint>
 
 struct sockaddr;
+struct statx;
 
 namespace rcs::io {
 
@@ -42,6 +79,29 @@ class service {
     /// @brief Executor type.
     using executor_t = TExecutorType;
 
+    /// @brief Handler of the failures of detached operations, taking the
+    ///        negated error code.
+    using sink_t = std::function<void(std::int32_t)>;
+
+  public:
+    /// @brief Results of a multishot operation.
+    class stream;
+
+    /// @brief Sequence of linked operations.
+    class chain;
+
+    /// @brief Awaiter of a single-shot operation.
+    class awaiter;
+
+  private:
+
+    /// @brief Completion running a unit of work.
+    template <typename TWork>
+    class posted;
+
+    /// @brief Completion of a message to another service.
+    class courier;
+
   public:
     service(const service &)                     = delete;
     auto operator=(const service &) -> service & = delete;
@@ -55,7 +115,8 @@ class service {
     service(service &&) = default;
 
     /// @brief Construct an asynchronous I/O service.
-    service(service::executor_t &&executor, std::uint32_t bandwidth);
+    service(service::executor_t &&executor, std::uint32_t bandwidth,
+            const rcs::io::options &options = {});
 
     /// @brief Default destructor.
     ~service() = default;
@@ -64,58 +125,660 @@ class service {
     /// @brief Check whether the service is idle.
     auto idle() const -> bool;
 
-    /// @brief Check whether the service is busy.
+    /// @brief Check whether the service is at or beyond capacity, in which
+    ///        case new operations wait for admission.
     auto busy() const -> bool;
 
     /// @brief Get the number of pending I/O operations.
     auto pending() const -> std::uint32_t;
 
+    /// @brief Get the number of I/O operations waiting for admission.
+    auto queued() const -> std::uint32_t;
+
     /// @brief Get the number of I/O operations that can be executed concurrently.
     auto bandwidth() const -> std::uint32_t;
 
+    /// @brief Get the service options.
+    auto options() const -> const rcs::io::options &;
+
+    /// @brief Get a snapshot of the service counters.
+    auto stats() const -> rcs::io::stats;
+
+    /// @brief Get the capabilities of the running kernel.
+    auto capabilities() const -> const rcs::io::capabilities &;
+
   public:
+    // Operations initiated while the service is at capacity are held in an
+    // admission queue, suspending their callers until completions free up
+    // enough slots. Held operations are admitted in FIFO order.
+    //
+    // Every operation takes additional submission flags. Pass
+    // rcs::io::uring::SQE_FIXED_FILE to refer to a file by its index in the
+    // registered file table instead of its descriptor.
+    //
+    // Operations attached to an rcs::io::cancellation complete with
+    // -ECANCELED once the cancellation is requested.
+
     /// @brief Accept a connection on a socket.
-    auto accept(std::int32_t descriptor, struct ::sockaddr &address, std::uint32_t size)
-        -> rcs::co::awaitable<std::int32_t>;
+    auto accept(std::int32_t descriptor, struct ::sockaddr &address, std::uint32_t size,
+                std::uint8_t flags = 0, rcs::io::cancellation *cancellation = nullptr)
+        -> service::awaiter;
 
     /// @brief Initiate a connection to a socket.
-    auto connect(std::int32_t descriptor, const struct ::sockaddr &address, std::uint32_t size)
-        -> rcs::co::awaitable<std::int32_t>;
+    auto connect(std::int32_t descriptor, const struct ::sockaddr &address, std::uint32_t size,
+                 std::uint8_t flags = 0, rcs::io::cancellation *cancellation = nullptr)
+        -> service::awaiter;
 
     /// @brief Read from a file descriptor into a specified buffer.
-    auto read(std::int32_t descriptor, void *buffer, std::uint32_t size, std::uint64_t offset = 0)
-        -> rcs::co::awaitable<std::int32_t>;
+    auto read(std::int32_t descriptor, void *buffer, std::uint32_t size, std::uint64_t offset = 0,
+              std::uint8_t flags = 0, rcs::io::cancellation *cancellation = nullptr)
+        -> service::awaiter;
 
     /// @brief Write to a file descriptor from a specified buffer.
-    auto write(std::int32_t descriptor, const void *buffer, std::uint32_t size, std::uint64_t offset = 0)
-        -> rcs::co::awaitable<std::int32_t>;
+    auto write(std::int32_t descriptor, const void *buffer, std::uint32_t size, std::uint64_t offset = 0,
+               std::uint8_t flags = 0, rcs::io::cancellation *cancellation = nullptr)
+        -> service::awaiter;
+
+  public:
+    /// @brief Read from a file descriptor into multiple buffers.
+    auto readv(std::int32_t descriptor, const struct ::iovec *vectors, std::uint32_t count,
+               std::uint64_t offset = 0, std::uint8_t flags = 0,
+               rcs::io::cancellation *cancellation = nullptr)
+        -> service::awaiter;
+
+    /// @brief Write to a file descriptor from multiple buffers.
+    auto writev(std::int32_t descriptor, const struct ::iovec *vectors, std::uint32_t count,
+                std::uint64_t offset = 0, std::uint8_t flags = 0,
+                rcs::io::cancellation *cancellation = nullptr)
+        -> service::awaiter;
+
+    /// @brief Send to a socket from a specified buffer.
+    auto send(std::int32_t descriptor, const void *buffer, std::uint32_t size, std::uint32_t msgflags = 0,
+              std::uint8_t flags = 0, rcs::io::cancellation *cancellation = nullptr)
+        -> service::awaiter;
+
+    /// @brief Receive from a socket into a specified buffer.
+    auto recv(std::int32_t descriptor, void *buffer, std::uint32_t size, std::uint32_t msgflags = 0,
+              std::uint8_t flags = 0, rcs::io::cancellation *cancellation = nullptr)
+        -> service::awaiter;
+
+    /// @brief Send a message to a socket.
+    auto sendmsg(std::int32_t descriptor, const struct ::msghdr &message, std::uint32_t msgflags = 0,
+                 std::uint8_t flags = 0, rcs::io::cancellation *cancellation = nullptr)
+        -> service::awaiter;
+
+    /// @brief Receive a message from a socket.
+    auto recvmsg(std::int32_t descriptor, struct ::msghdr &message, std::uint32_t msgflags = 0,
+                 std::uint8_t flags = 0, rcs::io::cancellation *cancellation = nullptr)
+        -> service::awaiter;
+
+  public:
+    // Deadline variants link a timeout to the operation. An operation that
+    // does not complete in time completes with -ETIME, as opposed to -ECANCELED
+    // for an explicitly cancelled one. The timeout takes a slot of its own.
+
+    /// @brief Accept a connection on a socket within the specified time.
+    auto accept_for(std::int32_t descriptor, struct ::sockaddr &address, std::uint32_t size,
+                    std::chrono::nanoseconds timeout,
+                    std::uint8_t flags = 0, rcs::io::cancellation *cancellation = nullptr)
+        -> service::awaiter;
+
+    /// @brief Initiate a connection to a socket to be established within the
+    ///        specified time.
+    auto connect_for(std::int32_t descriptor, const struct ::sockaddr &address, std::uint32_t size,
+                     std::chrono::nanoseconds timeout,
+                     std::uint8_t flags = 0, rcs::io::cancellation *cancellation = nullptr)
+        -> service::awaiter;
+
+    /// @brief Read from a file descriptor within the specified time.
+    auto read_for(std::int32_t descriptor, void *buffer, std::uint32_t size,
+                  std::chrono::nanoseconds timeout, std::uint64_t offset = 0,
+                  std::uint8_t flags = 0, rcs::io::cancellation *cancellation = nullptr)
+        -> service::awaiter;
+
+    /// @brief Write to a file descriptor within the specified time.
+    auto write_for(std::int32_t descriptor, const void *buffer, std::uint32_t size,
+                   std::chrono::nanoseconds timeout, std::uint64_t offset = 0,
+                   std::uint8_t flags = 0, rcs::io::cancellation *cancellation = nullptr)
+        -> service::awaiter;
+
+  public:
+    // File operations run in the kernel, so that opening, inspecting,
+    // synchronizing and closing files does not block the calling thread.
+
+    /// @brief Open a file relative to a directory.
+    auto openat(std::int32_t directory, const char *path, std::uint32_t oflags, std::uint32_t mode = 0)
+        -> service::awaiter;
+
+    /// @brief Close a file descriptor.
+    auto close(std::int32_t descriptor)
+        -> service::awaiter;
+
+    /// @brief Get the status of a file relative to a directory.
+    auto statx(std::int32_t directory, const char *path, std::uint32_t sflags, std::uint32_t mask,
+               struct ::statx &status)
+        -> service::awaiter;
+
+    ///
+    /// @brief   Flush the state of a file to the storage device.
+    ///
+    /// @details Pass rcs::io::uring::FSYNC_DATASYNC to flush only the data.
+    ///
+    auto fsync(std::int32_t descriptor, std::uint32_t fsflags = 0, std::uint8_t flags = 0)
+        -> service::awaiter;
+
+    /// @brief Allocate, deallocate or zero a range of a file.
+    auto fallocate(std::int32_t descriptor, std::uint32_t mode, std::uint64_t offset, std::uint64_t length,
+                   std::uint8_t flags = 0)
+        -> service::awaiter;
+
+  public:
+    ///
+    /// @brief   Wait for a descriptor to become ready.
+    ///
+    /// @details Completes with the mask of the events that occurred out of
+    ///          `events` (POLLIN, POLLOUT, ...), to which errors and hang-ups
+    ///          are always added.
+    ///
+    auto poll(std::int32_t descriptor, std::uint32_t events, std::uint8_t flags = 0,
+              rcs::io::cancellation *cancellation = nullptr)
+        -> service::awaiter;
+
+  public:
+    // Splicing moves data between two descriptors, one of which must be a
+    // pipe, without copying it through user space. Offsets of -1 stand for
+    // the current position, which pipes and sockets require.
+
+    /// @brief Move data from one descriptor to another through the kernel.
+    auto splice(std::int32_t in, std::int64_t inoffset, std::int32_t out, std::int64_t outoffset,
+                std::uint32_t size, std::uint32_t spflags = 0, std::uint8_t flags = 0,
+                rcs::io::cancellation *cancellation = nullptr)
+        -> service::awaiter;
+
+    /// @brief Copy data from one pipe to another without consuming it.
+    auto tee(std::int32_t in, std::int32_t out, std::uint32_t size, std::uint32_t spflags = 0,
+             std::uint8_t flags = 0, rcs::io::cancellation *cancellation = nullptr)
+        -> service::awaiter;
+
+    /// @brief Get the pool of pipes to splice data through.
+    auto pipes() -> rcs::io::pipe_pool &;
+
+  public:
+    ///
+    /// @brief   Register an arena of buffers whose pages stay pinned for as
+    ///          long as they are registered.
+    ///
+    /// @details The arena lives as long as the service and can only be
+    ///          registered once.
+    ///
+    /// @throws  rcs::system::exception
+    ///
+    auto register_buffers(std::uint32_t capacity, std::uint32_t size)
+        -> rcs::io::buffer_arena &;
+
+    /// @brief Get the registered buffer arena, if any.
+    auto buffers() const -> rcs::io::buffer_arena *;
+
+    /// @brief Read from a file descriptor into a registered buffer.
+    auto read_fixed(std::int32_t descriptor, const rcs::io::slice &slice, std::uint32_t size,
+                    std::uint64_t offset = 0, std::uint8_t flags = 0)
+        -> service::awaiter;
+
+    /// @brief Write to a file descriptor from a registered buffer.
+    auto write_fixed(std::int32_t descriptor, const rcs::io::slice &slice, std::uint32_t size,
+                     std::uint64_t offset = 0, std::uint8_t flags = 0)
+        -> service::awaiter;
+
+  public:
+    ///
+    /// @brief   Register a ring of buffers the kernel picks from once data
+    ///          arrives.
+    ///
+    /// @details `capacity` must be a power of two. The ring lives as long as
+    ///          the service. Fails with EOPNOTSUPP on kernels without buffer
+    ///          rings.
+    ///
+    /// @throws  rcs::system::exception
+    ///
+    auto provide(std::uint32_t capacity, std::uint32_t size)
+        -> rcs::io::buffer_ring &;
+
+    ///
+    /// @brief   Receive from a socket into a buffer picked from a ring.
+    ///
+    /// @details On success, `lease` holds the buffer picked by the kernel
+    ///          until it is released.
+    ///
+    auto recv(std::int32_t descriptor, rcs::io::buffer_ring &ring, rcs::io::lease &lease,
+              std::uint8_t flags = 0)
+        -> service::awaiter;
+
+  public:
+    ///
+    /// @brief   Send to a socket without copying the buffer into the kernel.
+    ///
+    /// @details The kernel posts the result first and a notification once
+    ///          it no longer references the buffer. The operation completes
+    ///          with the result, but only after the notification, so that
+    ///          the buffer can be reused right away. Falls back to a copying
+    ///          send on kernels without zero-copy sends.
+    ///
+    auto send_zc(std::int32_t descriptor, const void *buffer, std::uint32_t size,
+                 std::uint8_t flags = 0, rcs::io::cancellation *cancellation = nullptr)
+        -> service::awaiter;
+
+  public:
+    // Detached operations are not awaited. Kernels that can skip successful
+    // completions post no completion queue event for them unless they fail,
+    // which saves a pass of the event processing loop and an executor hop
+    // each. Such operations are not counted as pending: the service may turn
+    // idle while they are in flight, and their buffers must stay valid for as
+    // long as they may be. Failures are handed over to the sink by the event
+    // processing loop once it runs.
+
+    /// @brief   Set the handler of the failures of detached operations.
+    ///
+    /// @details Must not be called while the event processing loop runs.
+    ///          Failures are only counted until a sink is set.
+    void sink(service::sink_t sink);
+
+    /// @brief Write to a file descriptor from a specified buffer without
+    ///        awaiting the result.
+    void write_detached(std::int32_t descriptor, const void *buffer, std::uint32_t size,
+                        std::uint64_t offset = 0, std::uint8_t flags = 0);
+
+    /// @brief Write to a file descriptor from multiple buffers without
+    ///        awaiting the result.
+    void writev_detached(std::int32_t descriptor, const struct ::iovec *vectors, std::uint32_t count,
+                         std::uint64_t offset = 0, std::uint8_t flags = 0);
+
+  public:
+    ///
+    /// @brief   Start a sequence of operations to be submitted at once, each
+    ///          starting once the previous one has completed.
+    ///
+    /// @details The chain is awaited as a whole and yields the result of
+    ///          every operation.
+    ///
+    auto link() -> service::chain;
+
+  public:
+    ///
+    /// @brief   Accept connections on a socket until the returned stream is
+    ///          closed.
+    ///
+    /// @details Utilizes a single multishot submission, which is re-armed
+    ///          whenever the kernel terminates it without an error. Each
+    ///          result is either a connected socket descriptor or a negated
+    ///          error code. Kernels without multishot accept have a
+    ///          single-shot accept re-armed after every connection instead.
+    ///
+    auto accept_multishot(std::int32_t descriptor, std::uint8_t flags = 0)
+        -> service::stream;
+
+    ///
+    /// @brief   Receive from a socket into buffers picked from a ring until
+    ///          the returned stream is closed.
+    ///
+    /// @details Utilizes a single multishot submission for as long as data
+    ///          keeps arriving and the ring has buffers to spare. The stream
+    ///          terminates with the end of the connection, with an error, or
+    ///          with -ENOBUFS once the ring has run out of buffers, which is
+    ///          not re-armed; receiving again takes a new stream once buffers
+    ///          have been given back. Each result carries the number of
+    ///          received bytes and, in its flags, the index of the picked
+    ///          buffer. Kernels without multishot receives have a single-shot
+    ///          receive re-armed after every chunk instead.
+    ///
+    auto recv_multishot(std::int32_t descriptor, rcs::io::buffer_ring &ring, std::uint8_t flags = 0)
+        -> service::stream;
+
+  public:
+    ///
+    /// @brief   Register a sparse table of files the operations may refer to
+    ///          by their index.
+    ///
+    /// @details The table lives as long as the service and can only be
+    ///          registered once.
+    ///
+    /// @throws  rcs::system::exception
+    ///
+    auto register_files(std::uint32_t capacity)
+        -> rcs::io::file_table &;
+
+    /// @brief Get the registered file table, if any.
+    auto files() const -> rcs::io::file_table *;
+
+  public:
+    ///
+    /// @brief   Run a unit of work on the event processing loop of the
+    ///          service. May be called from any thread.
+    ///
+    /// @details Posts a completion queue event to the ring with
+    ///          IORING_OP_MSG_RING, which also wakes up a thread waiting for
+    ///          completions. The service is not idle until the work has run.
+    ///
+    template <typename TWork>
+    void post(TWork &&work);
+
+    ///
+    /// @brief   Run a unit of work on the event processing loop of another
+    ///          service.
+    ///
+    /// @details The message is submitted through the ring of this service,
+    ///          along with its other operations, which makes it the cheaper
+    ///          choice on a thread running this service.
+    ///
+    template <typename TWork>
+    void post(service &target, TWork &&work);
+
+  public:
+    /// @brief Maximum number of completions reaped at once.
+    static constexpr std::uint32_t MAX_BATCH = 128;
 
   public:
     /// @brief Run the event processing loop to execute at most one handler.
     void run_one();
 
-    /// @brief Run the event processing loop.
+    ///
+    /// @brief   Run the event processing loop to execute at most the
+    ///          specified number of handlers.
+    ///
+    /// @details Reaps every available completion, up to `max` and
+    ///          `MAX_BATCH`, under a single lock and releases the completion
+    ///          queue head once before executing the handlers.
+    ///
+    /// @return  Returns the number of executed handlers.
+    ///
+    auto run_batch(std::uint32_t max = service::MAX_BATCH) -> std::uint32_t;
+
+    /// @brief Run the event processing loop until there are no pending
+    ///        operations left.
     void run();
 
+    ///
+    /// @brief   Run the event processing loop until there are no pending
+    ///          operations left or the specified time has passed.
+    ///
+    /// @return  Returns the number of executed handlers.
+    ///
+    auto run_for(std::chrono::nanoseconds duration) -> std::uint64_t;
+
+    ///
+    /// @brief   Run the event processing loop until there are no pending
+    ///          operations left or the specified deadline has been reached.
+    ///
+    /// @return  Returns the number of executed handlers.
+    ///
+    auto run_until(std::chrono::steady_clock::time_point deadline) -> std::uint64_t;
+
   private:
     /// @brief Default constructor.
     service() = default;
 
+  private:
+    /// @brief Describe an initiation of a connection to a socket.
+    static auto _connect(std::int32_t descriptor, const struct ::sockaddr &address, std::uint32_t size,
+                         std::uint8_t flags) -> rcs::io::uring::sqe;
+
+    /// @brief Describe a read from a file descriptor into a buffer.
+    static auto _read(std::int32_t descriptor, void *buffer, std::uint32_t size, std::uint64_t offset,
+                      std::uint8_t flags) -> rcs::io::uring::sqe;
+
+    /// @brief Describe a write to a file descriptor from a buffer.
+    static auto _write(std::int32_t descriptor, const void *buffer, std::uint32_t size, std::uint64_t offset,
+                       std::uint8_t flags) -> rcs::io::uring::sqe;
+
+    /// @brief Describe a read from a file descriptor into multiple buffers.
+    static auto _readv(std::int32_t descriptor, const struct ::iovec *vectors, std::uint32_t count,
+                       std::uint64_t offset, std::uint8_t flags) -> rcs::io::uring::sqe;
+
+    /// @brief Describe a write to a file descriptor from multiple buffers.
+    static auto _writev(std::int32_t descriptor, const struct ::iovec *vectors, std::uint32_t count,
+                        std::uint64_t offset, std::uint8_t flags) -> rcs::io::uring::sqe;
+
+    /// @brief Describe a message sent to a socket.
+    static auto _sendmsg(std::int32_t descriptor, const struct ::msghdr &message, std::uint32_t msgflags,
+                         std::uint8_t flags) -> rcs::io::uring::sqe;
+
+    /// @brief Describe a message received from a socket.
+    static auto _recvmsg(std::int32_t descriptor, struct ::msghdr &message, std::uint32_t msgflags,
+                         std::uint8_t flags) -> rcs::io::uring::sqe;
+
+    /// @brief Describe a wait for a descriptor to become ready.
+    static auto _poll(std::int32_t descriptor, std::uint32_t events, std::uint8_t flags)
+        -> rcs::io::uring::sqe;
+
+    /// @brief Describe a transfer from one descriptor to another through
+    ///        the kernel.
+    static auto _splice(std::int32_t in, std::int64_t inoffset, std::int32_t out, std::int64_t outoffset,
+                        std::uint32_t size, std::uint32_t spflags, std::uint8_t flags) -> rcs::io::uring::sqe;
+
+  private:
+    /// @brief   Submit the entries acquired from the submission queue.
+    ///
+    /// @details Does nothing if the submission is deferred to the event
+    ///          processing loop. Must be called by the owner of the
+    ///          submission queue.
+    void _submit();
+
+    /// @brief   Hand the staged entries over to the polling thread, waking it
+    ///          up if needed. Must be called by the owner of the submission
+    ///          queue.
+    void _publish();
+
+    /// @brief Submit the specified number of entries and wait for the
+    ///        specified number of completions within a single system call.
+    void _enter(std::uint32_t submitnr, std::uint32_t waitnr);
+
+    ///
+    /// @brief   Submit the specified number of entries and wait for the
+    ///          specified number of completions within the specified time.
+    ///
+    /// @return  Returns `false` if the time ran out first.
+    ///
+    auto _enter(std::uint32_t submitnr, std::uint32_t waitnr, const rcs::io::uring::timespec &timeout)
+        -> bool;
+
+    ///
+    /// @brief   Submit the specified number of entries and make sure the
+    ///          completion queue is not empty, according to the wait policy.
+    ///
+    /// @details Must be called under the completion queue lock.
+    ///
+    /// @return  Returns `false` if the deadline, if any, passed first.
+    ///
+    auto _wait(std::uint32_t submitnr, const std::chrono::steady_clock::time_point *deadline) -> bool;
+
+    ///
+    /// @brief   Check whether there is a completion to wait for, submitting
+    ///          the specified number of entries right away if there is not.
+    ///
+    /// @details Must be called under the completion queue lock. Another
+    ///          thread may have reaped the last completion in the meantime,
+    ///          and detached operations may have been the only ones staged.
+    ///
+    auto _expecting(std::uint32_t submitnr) -> bool;
+
+    /// @brief Run the event processing loop to execute at most the
+    ///        specified number of handlers, waiting no longer than until the
+    ///        deadline, if any.
+    auto _run(std::uint32_t max, const std::chrono::steady_clock::time_point *deadline) -> std::uint32_t;
+
+    /// @brief   Make the staged entries visible to the kernel.
+    ///
+    /// @return  Returns the number of entries to be submitted by the event
+    ///          processing loop.
+    auto _flush() -> std::uint32_t;
+
+    /// @brief Execute the handler of a completion queue event.
+    void _dispatch(const rcs::io::uring::cqe &cqe);
+
+    /// @brief Check whether a completion queue event finishes a pending
+    ///        operation.
+    auto _finishes(const rcs::io::uring::cqe &cqe) const -> bool;
+
+    /// @brief   Enable a ring set up disabled, making the calling thread its
+    ///          single issuer, and register the ring descriptor for it.
+    void _enable();
+
+    ///
+    /// @brief   Stage a poll on the wakeup descriptor unless one is armed.
+    ///
+    /// @details Must be called by the owner of the submission queue.
+    ///
+    void _arm();
+
+    /// @brief Reset the wakeup descriptor once its poll has completed.
+    void _rearm();
+
+    /// @brief Entry along with the handler of its completions.
+    struct link_t {
+        rcs::io::uring::sqe  entry;
+        rcs::io::completion *handler = nullptr;
+    };
+
+    ///
+    /// @brief   Request to stage a sequence of entries, each linked to the
+    ///          next one.
+    ///
+    /// @details Owned by the initiator, which must keep it and the entries
+    ///          alive until the operation has completed.
+    ///
+    struct request_t {
+        std::atomic<struct request_t *> next = nullptr;
+        std::span<const struct link_t>  links;
+
+        /// @brief Token of the operation to be cancelled, if any.
+        std::uint64_t target = 0;
+
+        /// @brief Whether the request is owned by the service.
+        bool owned = false;
+    };
+
+    /// @brief Request owned by the service.
+    struct owned_t final : request_t {
+        struct link_t link;
+    };
+
+    ///
+    /// @brief   Stage the entries of a request.
+    ///
+    /// @details The entries are admitted, staged and submitted together.
+    ///          They are submitted right away, unless the submission is
+    ///          deferred to the event processing loop. Another thread owning
+    ///          the submission queue in the meantime may submit them first.
+    ///
+    void _initiate(struct request_t &request);
+
+    /// @brief Process the pending requests under the ownership of the
+    ///        submission queue.
+    void _combine();
+
+    /// @brief Wait for the ownership of the submission queue.
+    void _own();
+
+    /// @brief Give up the ownership of the submission queue.
+    void _disown();
+
+    /// @brief Admit, stage and submit the pending requests. Must be called
+    ///        by the owner of the submission queue.
+    void _process();
+
+    /// @brief Stage a sequence of linked entries bypassing the admission
+    ///        queue. Must be called by the owner of the submission queue.
+    void _stage(std::span<const struct link_t> links);
+
+    /// @brief Check whether an operation taking the specified number of
+    ///        slots can be admitted.
+    auto _fits(std::uint32_t slots) const -> bool;
+
+    ///
+    /// @brief   Check whether the submission queue has room for the
+    ///          specified number of entries.
+    ///
+    /// @details Submits the staged entries to make room, unless the
+    ///          submission is deferred, since only the event processing loop
+    ///          may enter the ring then. Must be called by the owner of the
+    ///          submission queue.
+    ///
+    auto _room(std::uint32_t slots) -> bool;
+
+    /// @brief Stage the held operations for which there are free slots and
+    ///        complete the held operations that have been cancelled.
+    void _admit();
+
+    /// @brief Request cancellation of the operation carrying the specified
+    ///        token.
+    void _cancel(std::uint64_t token);
+
+    ///
+    /// @brief   Stage an entry on behalf of the service itself.
+    ///
+    /// @details The entry bypasses the admission queue. If it is a
+    ///          cancellation request, `target` is the token of the operation
+    ///          it targets.
+    ///
+    void _bypass(const rcs::io::uring::sqe &entry, rcs::io::completion *handler, std::uint64_t target = 0);
+
+    /// @brief Post a completion queue event carrying the specified handler
+    ///        to the ring.
+    void _deliver(rcs::io::completion *handler);
+
+    /// @brief Handler of the operations whose results are of no interest.
+    static void _ignore(rcs::io::completion *self, std::int32_t result, std::uint32_t flags);
+
+    /// @brief Stage a detached operation.
+    void _detach(rcs::io::uring::sqe entry);
+
+    /// @brief Handler of the detached operations.
+    static void _fail(rcs::io::completion *self, std::int32_t result, std::uint32_t flags);
+
   private:
     /// @brief Utilized executor.
     service::executor_t m_executor{};
 
+    /// @brief Service options.
+    rcs::io::options m_options{};
+
     /// @brief io_uring instance identifier.
     rcs::system::handle m_handle{-1};
 
+    /// @brief Capabilities of the running kernel.
+    rcs::io::capabilities m_capabilities{};
+
+  private:
+    struct issuer_t {
+        /// @brief Whether the ring has been enabled.
+        bool enabled = true;
+
+        /// @brief Index of the ring descriptor registered by the issuer, if
+        ///        any.
+        std::int32_t registered = -1;
+    };
+
+    /// @brief Single issuer state, only accessed by the issuer.
+    struct issuer_t m_issuer = {};
+
   private:
+    struct staging_t {
+        rcs::io::mpsc_queue<struct request_t> requests;
+        std::mutex                            mutex;
+    };
+
     struct sq_t {
-        rcs::io::uring::sqr         r;
-        std::unique_ptr<std::mutex> mutex =
-            std::make_unique<std::mutex>();
+        rcs::io::uring::sqr               r;
+        std::unique_ptr<struct staging_t> staging =
+            std::make_unique<struct staging_t>();
     };
 
-    /// @brief Submission queue.
+    ///
+    /// @brief   Submission queue.
+    ///
+    /// @details Initiators push their requests and take the mutex guarding
+    ///          the ring. Its owner copies every pending request into the
+    ///          ring, including the ones pushed by others waiting for it.
+    ///
     struct service::sq_t m_sq = {};
 
   private:
@@ -128,276 +791,2051 @@ class service {
     /// @brief Completion queue.
     struct service::cq_t m_cq = {};
 
+  private:
+    struct rings_t {
+        std::vector<std::unique_ptr<rcs::io::buffer_ring>> list;
+        std::unique_ptr<std::mutex>                        mutex =
+            std::make_unique<std::mutex>();
+    };
+
+    /// @brief Provided buffer rings.
+    struct service::rings_t m_rings = {};
+
+  private:
+    struct admission_t {
+        std::deque<struct request_t *>     queue;
+        std::vector<rcs::io::completion *> cancelled;
+
+        /// @brief Requests bypassing admission that did not fit the
+        ///        submission queue, staged in order once it has room.
+        std::deque<struct request_t *> overflow;
+    };
+
+    /// @brief Operations waiting for admission, guarded by the ownership of
+    ///        the submission queue.
+    struct service::admission_t m_admission = {};
+
+    /// @brief Registered file table.
+    std::unique_ptr<rcs::io::file_table> m_files;
+
+    /// @brief Registered buffer arena.
+    std::unique_ptr<rcs::io::buffer_arena> m_arena;
+
+    /// @brief Pipes to splice data through.
+    std::unique_ptr<rcs::io::pipe_pool> m_pipes =
+        std::make_unique<rcs::io::pipe_pool>();
+
   private:
     /// @brief Number of pending operations.
     std::atomic<std::uint32_t> m_pending = {0};
 
+    /// @brief Number of operations initiated but not yet staged.
+    std::atomic<std::uint32_t> m_queued = {0};
+
     /// @brief Number of I/O operations that can be executed concurrently.
     std::atomic<std::uint32_t> m_bandwidth = {0};
+
+    /// @brief Completion handler discarding the results.
+    rcs::io::completion m_discard{&service::_ignore};
+
+    struct detached_t final : rcs::io::completion {
+        detached_t()
+            : rcs::io::completion(&service::_fail) {}
+
+        service::sink_t            sink;
+        std::atomic<std::uint64_t> failures = {0};
+
+        /// @brief Number of entries staged for the event processing loop to
+        ///        submit.
+        std::atomic<std::uint32_t> deferred = {0};
+    };
+
+    /// @brief Completion handler of the detached operations.
+    std::unique_ptr<struct detached_t> m_detached =
+        std::make_unique<struct detached_t>();
+
+    struct wakeup_t final {
+        /// @brief Event descriptor, valid only if the loop may need it.
+        rcs::system::handle handle{-1};
+
+        /// @brief Whether a poll is armed on the descriptor.
+        std::atomic<bool> armed = false;
+    };
+
+    ///
+    /// @brief   Wakeup of the event processing loop.
+    ///
+    /// @details With deferred submission, the loop keeps a poll armed on the
+    ///          descriptor, so that a thread staging an entry the loop waits
+    ///          for can wake it up. Only needed by posted work on kernels
+    ///          that cannot message the ring directly. The poll is not
+    ///          counted as pending.
+    ///
+    std::unique_ptr<struct wakeup_t> m_wakeup =
+        std::make_unique<struct wakeup_t>();
+
+  private:
+    struct counters_t {
+        std::atomic<std::uint64_t> enters      = {0};
+        std::atomic<std::uint64_t> submitted   = {0};
+        std::atomic<std::uint64_t> reaps       = {0};
+        std::atomic<std::uint64_t> completions = {0};
+        std::atomic<std::uint64_t> admissions  = {0};
+    };
+
+    /// @brief Service counters.
+    struct service::counters_t m_counters = {};
 };
 
 } // namespace rcs::io
 
 template <rcs::execution::executor TExecutorType>
-rcs::io::service<TExecutorType>::service(service::executor_t &&executor, std::uint32_t bandwidth)
-    : m_executor(std::forward<service::executor_t>(executor)), m_bandwidth(bandwidth) {
+rcs::io::service<TExecutorType>::service(
+    service::executor_t &&executor, std::uint32_t bandwidth, const rcs::io::options &options)
+    : m_executor(std::forward<service::executor_t>(executor)), m_options(options), m_bandwidth(bandwidth) {
     rcs::io::uring::params params;
 
-    params.flags |= rcs::io::uring::SETUP_NO_SQARRAY;
     params.flags |= rcs::io::uring::SETUP_CQSIZE;
     params.flags |= rcs::io::uring::SETUP_CLAMP;
 
+    if (m_options.sqpoll.enabled) {
+        params.flags |= rcs::io::uring::SETUP_SQPOLL;
+        params.sq_thread_idle = m_options.sqpoll.idle;
+
+        if (m_options.sqpoll.cpu >= 0) {
+            params.flags |= rcs::io::uring::SETUP_SQ_AFF;
+            params.sq_thread_cpu = static_cast<std::uint32_t>(m_options.sqpoll.cpu);
+        }
+    }
+
     params.cq_capacity = m_bandwidth.load();
-    m_handle           = rcs::system::handle(
-        rcs::io::uring::setup(m_bandwidth.load(), params));
+
+    std::uint32_t profile = 0;
+    switch (m_options.profile) {
+    case rcs::io::profile::shared:
+        break;
+    case rcs::io::profile::cooperative:
+        profile = rcs::io::uring::SETUP_COOP_TASKRUN | rcs::io::uring::SETUP_TASKRUN_FLAG;
+        break;
+    case rcs::io::profile::single_issuer:
+        // The ring is enabled by the thread that first runs the loop, which
+        // becomes its only submitter.
+        profile = rcs::io::uring::SETUP_SINGLE_ISSUER | rcs::io::uring::SETUP_DEFER_TASKRUN |
+                  rcs::io::uring::SETUP_TASKRUN_FLAG | rcs::io::uring::SETUP_R_DISABLED;
+        break;
+    }
+
+    // Older kernels reject the flags they do not know, in which case the
+    // profile, and then the removal of the indirection array, are dropped.
+    const std::array<std::uint32_t, 4> attempts = {
+        profile | rcs::io::uring::SETUP_NO_SQARRAY, profile, rcs::io::uring::SETUP_NO_SQARRAY, 0};
+
+    const rcs::io::uring::params base       = params;
+    std::int32_t                 descriptor = -1;
+    for (const std::uint32_t flags : attempts) {
+        params = base;
+        params.flags |= flags;
+
+        try {
+            descriptor = rcs::io::uring::setup(m_bandwidth.load(), params);
+            break;
+        } catch (const rcs::system::exception &e) {
+            if (e.error_code() != EINVAL or flags == attempts.back()) throw;
+        }
+    }
+
+    m_handle       = rcs::system::handle(descriptor);
+    m_capabilities = rcs::io::capabilities(m_handle.descriptor(), params);
 
     m_sq.r = rcs::io::uring::sqr(m_handle.descriptor(), params);
     m_cq.r = rcs::io::uring::cqr(m_handle.descriptor(), params);
+
+    // Reflect the profile in effect. Only the loop may submit to a ring with
+    // a single issuer.
+    if ((params.flags & profile) != profile) m_options.profile = rcs::io::profile::shared;
+    if ((params.flags & rcs::io::uring::SETUP_SINGLE_ISSUER) != 0)
+        m_options.submission = rcs::io::submission::deferred;
+
+    if (m_options.submission == rcs::io::submission::deferred and not m_capabilities.direct_messages()) {
+        const std::int32_t wakeup = ::eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+        if (wakeup == -1) throw rcs::system::exception(errno);
+        m_wakeup->handle = rcs::system::handle(wakeup);
+    }
+
+    m_issuer.enabled = (params.flags & rcs::io::uring::SETUP_R_DISABLED) == 0;
 }
 
 template <rcs::execution::executor TExecutorType>
 auto rcs::io::service<TExecutorType>::idle()
-    const -> bool { return service::pending() == 0; }
+    const -> bool {
+    // Detached operations may still await submission, and the completion
+    // queue may hold their failures.
+    return service::pending() == 0 and service::queued() == 0 and
+           m_detached->deferred.load() == 0 and m_cq.r.empty();
+}
 
 template <rcs::execution::executor TExecutorType>
 auto rcs::io::service<TExecutorType>::busy()
-    const -> bool { return service::pending() == service::bandwidth(); }
+    const -> bool { return service::pending() >= service::bandwidth(); }
 
 template <rcs::execution::executor TExecutorType>
 auto rcs::io::service<TExecutorType>::pending()
     const -> std::uint32_t { return m_pending.load(); }
 
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::queued()
+    const -> std::uint32_t { return m_queued.load(); }
+
 template <rcs::execution::executor TExecutorType>
 auto rcs::io::service<TExecutorType>::bandwidth()
     const -> std::uint32_t { return m_bandwidth.load(); }
 
 template <rcs::execution::executor TExecutorType>
-auto rcs::io::service<TExecutorType>::accept(
-    std::int32_t descriptor, struct ::sockaddr &address, std::uint32_t size)
-    -> rcs::co::awaitable<std::int32_t> {
-    assert(not busy());
-
-    struct awaiter {
-        rcs::io::service<TExecutorType>             *service = nullptr;
-        rcs::io::token<int, std::coroutine_handle<>> token   = {-1, nullptr};
-
-        std::int32_t       descriptor = -1;
-        struct ::sockaddr *address    = nullptr;
-        std::uint32_t      size       = 0;
-
-        auto await_ready() const -> bool { return false; }
-        auto await_resume() -> int { return token.result; };
-
-        void await_suspend(std::coroutine_handle<> caller) {
-            service->m_executor.execute([caller, this]() {
-                const std::unique_lock<std::mutex> sql(*service->m_sq.mutex);
-                rcs::io::uring::sqr               *sqr = &service->m_sq.r;
-                rcs::io::uring::sqe               *sqe = &sqr->next();
-
-                sqe->opcode     = rcs::io::uring::op::accept;
-                sqe->descriptor = descriptor;
-                sqe->address    = address;
-                sqe->addrlen2   = &size;
-
-                token.result       = -1;
-                token.continuation = caller;
-                sqe->token         = reinterpret_cast<std::uint64_t>(&token);
-
-                sqr->submit();
-                service->m_pending.fetch_add(1);
-            });
-        }
-    };
+auto rcs::io::service<TExecutorType>::options()
+    const -> const rcs::io::options & { return m_options; }
 
-    const std::int32_t ret = co_await awaiter{
-        .service    = this,
-        .descriptor = descriptor,
-        .address    = &address,
-        .size       = size};
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::stats()
+    const -> rcs::io::stats {
+    return rcs::io::stats{
+        .enters      = m_counters.enters.load(std::memory_order::relaxed),
+        .submitted   = m_counters.submitted.load(std::memory_order::relaxed),
+        .reaps       = m_counters.reaps.load(std::memory_order::relaxed),
+        .completions = m_counters.completions.load(std::memory_order::relaxed),
+        .admissions  = m_counters.admissions.load(std::memory_order::relaxed),
+        .overflow    = m_cq.r.overflow(),
+        .failures    = m_detached->failures.load(std::memory_order::relaxed)};
+}
+
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::capabilities()
+    const -> const rcs::io::capabilities & { return m_capabilities; }
+
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::accept(
+    std::int32_t descriptor, struct ::sockaddr &address, std::uint32_t size, std::uint8_t flags,
+    rcs::io::cancellation *cancellation)
+    -> service::awaiter {
+    rcs::io::uring::sqe entry;
+    entry.opcode     = rcs::io::uring::op::accept;
+    entry.flags      = flags;
+    entry.descriptor = descriptor;
+    entry.address    = &address;
+
+    service::awaiter awaiter(this, entry, cancellation);
+    awaiter.m_addrlen = size;
+    return awaiter;
+}
 
-    co_return ret;
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::accept_for(
+    std::int32_t descriptor, struct ::sockaddr &address, std::uint32_t size, std::chrono::nanoseconds timeout, std::uint8_t flags,
+    rcs::io::cancellation *cancellation)
+    -> service::awaiter {
+    rcs::io::uring::sqe entry;
+    entry.opcode     = rcs::io::uring::op::accept;
+    entry.flags      = flags;
+    entry.descriptor = descriptor;
+    entry.address    = &address;
+
+    service::awaiter awaiter(this, entry, timeout, cancellation);
+    awaiter.m_addrlen = size;
+    return awaiter;
 }
 
 /// @brief Initiate a connection to a socket.
 template <rcs::execution::executor TExecutorType>
 auto rcs::io::service<TExecutorType>::connect(
-    std::int32_t descriptor, const struct ::sockaddr &address, std::uint32_t size)
-    -> rcs::co::awaitable<std::int32_t> {
-    assert(not busy());
-
-    struct awaiter {
-        rcs::io::service<TExecutorType>             *service = nullptr;
-        rcs::io::token<int, std::coroutine_handle<>> token   = {-1, nullptr};
-
-        std::int32_t             descriptor = -1;
-        const struct ::sockaddr *address    = nullptr;
-        std::uint32_t            size       = 0;
-
-        auto await_ready() const -> bool { return false; }
-        auto await_resume() -> int { return token.result; };
-
-        void await_suspend(std::coroutine_handle<> caller) {
-            service->m_executor.execute([caller, this]() {
-                const std::unique_lock<std::mutex> sql(*service->m_sq.mutex);
-                rcs::io::uring::sqr               *sqr = &service->m_sq.r;
-                rcs::io::uring::sqe               *sqe = &sqr->next();
-
-                sqe->opcode     = rcs::io::uring::op::connect;
-                sqe->descriptor = descriptor;
-                sqe->address    = const_cast<struct ::sockaddr *>(address);
-                sqe->addrlen    = size;
-
-                token.result       = -1;
-                token.continuation = caller;
-                sqe->token         = reinterpret_cast<std::uint64_t>(&token);
-
-                sqr->submit();
-                service->m_pending.fetch_add(1);
-            });
-        }
-    };
-
-    const std::int32_t ret = co_await awaiter{
-        .service    = this,
-        .descriptor = descriptor,
-        .address    = &address,
-        .size       = size};
+    std::int32_t descriptor, const struct ::sockaddr &address, std::uint32_t size, std::uint8_t flags,
+    rcs::io::cancellation *cancellation)
+    -> service::awaiter {
+    return service::awaiter(this, service::_connect(descriptor, address, size, flags), cancellation);
+}
 
-    co_return ret;
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::connect_for(
+    std::int32_t descriptor, const struct ::sockaddr &address, std::uint32_t size, std::chrono::nanoseconds timeout, std::uint8_t flags,
+    rcs::io::cancellation *cancellation)
+    -> service::awaiter {
+    return service::awaiter(this, service::_connect(descriptor, address, size, flags), timeout, cancellation);
 }
 
 template <rcs::execution::executor TExecutorType>
 auto rcs::io::service<TExecutorType>::read(
-    std::int32_t descriptor, void *buffer, std::uint32_t size, std::uint64_t offset)
-    -> rcs::co::awaitable<std::int32_t> {
-    assert(not busy());
-
-    struct awaiter {
-        rcs::io::service<TExecutorType>             *service = nullptr;
-        rcs::io::token<int, std::coroutine_handle<>> token   = {-1, nullptr};
-
-        std::int32_t  descriptor = -1;
-        void         *buffer     = nullptr;
-        std::uint32_t size       = 0;
-        std::uint64_t offset     = 0;
-
-        auto await_ready() const -> bool { return false; }
-        auto await_resume() -> int { return token.result; };
-
-        void await_suspend(std::coroutine_handle<> caller) {
-            service->m_executor.execute([caller, this]() {
-                const std::unique_lock<std::mutex> sql(*service->m_sq.mutex);
-                rcs::io::uring::sqr               *sqr = &service->m_sq.r;
-                rcs::io::uring::sqe               *sqe = &sqr->next();
-
-                sqe->opcode     = rcs::io::uring::op::read;
-                sqe->descriptor = descriptor;
-                sqe->buffer     = buffer;
-                sqe->bufsize    = size;
-                sqe->offset     = offset;
-
-                token.result       = -1;
-                token.continuation = caller;
-                sqe->token         = reinterpret_cast<std::uint64_t>(&token);
-
-                sqr->submit();
-                service->m_pending.fetch_add(1);
-            });
-        }
-    };
-
-    int ret = co_await awaiter{
-        .service    = this,
-        .descriptor = descriptor,
-        .buffer     = buffer,
-        .size       = size,
-        .offset     = offset};
+    std::int32_t descriptor, void *buffer, std::uint32_t size, std::uint64_t offset, std::uint8_t flags,
+    rcs::io::cancellation *cancellation)
+    -> service::awaiter {
+    return service::awaiter(this, service::_read(descriptor, buffer, size, offset, flags), cancellation);
+}
 
-    co_return ret;
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::read_for(
+    std::int32_t descriptor, void *buffer, std::uint32_t size, std::chrono::nanoseconds timeout, std::uint64_t offset, std::uint8_t flags,
+    rcs::io::cancellation *cancellation)
+    -> service::awaiter {
+    return service::awaiter(this, service::_read(descriptor, buffer, size, offset, flags), timeout, cancellation);
 }
 
 template <rcs::execution::executor TExecutorType>
 auto rcs::io::service<TExecutorType>::write(
-    std::int32_t descriptor, const void *buffer, std::uint32_t size, std::uint64_t offset)
-    -> rcs::co::awaitable<std::int32_t> {
-    assert(not busy());
-
-    struct awaiter {
-        rcs::io::service<TExecutorType>             *service = nullptr;
-        rcs::io::token<int, std::coroutine_handle<>> token   = {-1, nullptr};
-
-        int           descriptor = -1;
-        const void   *buffer     = nullptr;
-        std::uint32_t bufsize    = 0;
-        std::uint64_t offset     = 0;
-
-        auto await_ready() const -> bool { return false; }
-        auto await_resume() -> int { return token.result; };
-
-        void await_suspend(std::coroutine_handle<> caller) {
-            service->m_executor.execute([caller, this]() {
-                const std::unique_lock<std::mutex> sqlock(*service->m_sq.mutex);
-                rcs::io::uring::sqr               *sqr = &service->m_sq.r;
-                rcs::io::uring::sqe               *sqe = &sqr->next();
-
-                sqe->opcode     = rcs::io::uring::op::write;
-                sqe->descriptor = descriptor;
-                sqe->buffer     = const_cast<void *>(buffer);
-                sqe->bufsize    = bufsize;
-                sqe->offset     = offset;
-
-                token.result       = -1;
-                token.continuation = caller;
-                sqe->token         = reinterpret_cast<std::uint64_t>(&token);
-
-                sqr->submit();
-                service->m_pending.fetch_add(1);
-            });
-        }
-    };
+    std::int32_t descriptor, const void *buffer, std::uint32_t size, std::uint64_t offset, std::uint8_t flags,
+    rcs::io::cancellation *cancellation)
+    -> service::awaiter {
+    return service::awaiter(this, service::_write(descriptor, buffer, size, offset, flags), cancellation);
+}
+
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::write_for(
+    std::int32_t descriptor, const void *buffer, std::uint32_t size, std::chrono::nanoseconds timeout, std::uint64_t offset, std::uint8_t flags,
+    rcs::io::cancellation *cancellation)
+    -> service::awaiter {
+    return service::awaiter(this, service::_write(descriptor, buffer, size, offset, flags), timeout, cancellation);
+}
+
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::readv(
+    std::int32_t descriptor, const struct ::iovec *vectors, std::uint32_t count, std::uint64_t offset,
+    std::uint8_t flags, rcs::io::cancellation *cancellation)
+    -> service::awaiter {
+    return service::awaiter(this, service::_readv(descriptor, vectors, count, offset, flags), cancellation);
+}
+
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::writev(
+    std::int32_t descriptor, const struct ::iovec *vectors, std::uint32_t count, std::uint64_t offset,
+    std::uint8_t flags, rcs::io::cancellation *cancellation)
+    -> service::awaiter {
+    return service::awaiter(this, service::_writev(descriptor, vectors, count, offset, flags), cancellation);
+}
+
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::send(
+    std::int32_t descriptor, const void *buffer, std::uint32_t size, std::uint32_t msgflags,
+    std::uint8_t flags, rcs::io::cancellation *cancellation)
+    -> service::awaiter {
+    rcs::io::uring::sqe entry;
+    entry.opcode     = rcs::io::uring::op::send;
+    entry.flags      = flags;
+    entry.descriptor = descriptor;
+    entry.buffer     = const_cast<void *>(buffer);
+    entry.bufsize    = size;
+    entry.msg_flags  = msgflags;
+
+    return service::awaiter(this, entry, cancellation);
+}
+
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::recv(
+    std::int32_t descriptor, void *buffer, std::uint32_t size, std::uint32_t msgflags,
+    std::uint8_t flags, rcs::io::cancellation *cancellation)
+    -> service::awaiter {
+    rcs::io::uring::sqe entry;
+    entry.opcode     = rcs::io::uring::op::recv;
+    entry.flags      = flags;
+    entry.descriptor = descriptor;
+    entry.buffer     = buffer;
+    entry.bufsize    = size;
+    entry.msg_flags  = msgflags;
+
+    return service::awaiter(this, entry, cancellation);
+}
+
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::sendmsg(
+    std::int32_t descriptor, const struct ::msghdr &message, std::uint32_t msgflags,
+    std::uint8_t flags, rcs::io::cancellation *cancellation)
+    -> service::awaiter {
+    return service::awaiter(this, service::_sendmsg(descriptor, message, msgflags, flags), cancellation);
+}
+
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::recvmsg(
+    std::int32_t descriptor, struct ::msghdr &message, std::uint32_t msgflags,
+    std::uint8_t flags, rcs::io::cancellation *cancellation)
+    -> service::awaiter {
+    return service::awaiter(this, service::_recvmsg(descriptor, message, msgflags, flags), cancellation);
+}
+
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::openat(
+    std::int32_t directory, const char *path, std::uint32_t oflags, std::uint32_t mode)
+    -> service::awaiter {
+    rcs::io::uring::sqe entry;
+    entry.opcode     = rcs::io::uring::op::openat;
+    entry.descriptor = directory;
+    entry.path       = path;
+    entry.mode       = mode;
+    entry.open_flags = oflags;
+
+    return service::awaiter(this, entry);
+}
+
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::close(std::int32_t descriptor)
+    -> service::awaiter {
+    rcs::io::uring::sqe entry;
+    entry.opcode     = rcs::io::uring::op::close;
+    entry.descriptor = descriptor;
+
+    return service::awaiter(this, entry);
+}
+
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::statx(
+    std::int32_t directory, const char *path, std::uint32_t sflags, std::uint32_t mask, struct ::statx &status)
+    -> service::awaiter {
+    rcs::io::uring::sqe entry;
+    entry.opcode      = rcs::io::uring::op::statx;
+    entry.descriptor  = directory;
+    entry.path        = path;
+    entry.mask        = mask;
+    entry.statxbuf    = &status;
+    entry.statx_flags = sflags;
+
+    return service::awaiter(this, entry);
+}
+
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::fsync(std::int32_t descriptor, std::uint32_t fsflags, std::uint8_t flags)
+    -> service::awaiter {
+    rcs::io::uring::sqe entry;
+    entry.opcode      = rcs::io::uring::op::fsync;
+    entry.flags       = flags;
+    entry.descriptor  = descriptor;
+    entry.fsync_flags = fsflags;
+
+    return service::awaiter(this, entry);
+}
+
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::fallocate(
+    std::int32_t descriptor, std::uint32_t mode, std::uint64_t offset, std::uint64_t length, std::uint8_t flags)
+    -> service::awaiter {
+    rcs::io::uring::sqe entry;
+    entry.opcode     = rcs::io::uring::op::fallocate;
+    entry.flags      = flags;
+    entry.descriptor = descriptor;
+    entry.offset     = offset;
+    entry.length     = length;
+    entry.mode       = mode;
+
+    return service::awaiter(this, entry);
+}
+
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::poll(
+    std::int32_t descriptor, std::uint32_t events, std::uint8_t flags, rcs::io::cancellation *cancellation)
+    -> service::awaiter {
+    return service::awaiter(this, service::_poll(descriptor, events, flags), cancellation);
+}
+
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::splice(
+    std::int32_t in, std::int64_t inoffset, std::int32_t out, std::int64_t outoffset, std::uint32_t size,
+    std::uint32_t spflags, std::uint8_t flags, rcs::io::cancellation *cancellation)
+    -> service::awaiter {
+    return service::awaiter(this, service::_splice(in, inoffset, out, outoffset, size, spflags, flags), cancellation);
+}
+
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::tee(
+    std::int32_t in, std::int32_t out, std::uint32_t size, std::uint32_t spflags, std::uint8_t flags,
+    rcs::io::cancellation *cancellation)
+    -> service::awaiter {
+    rcs::io::uring::sqe entry;
+    entry.opcode       = rcs::io::uring::op::tee;
+    entry.flags        = flags;
+    entry.descriptor   = out;
+    entry.splice_in    = in;
+    entry.bufsize      = size;
+    entry.splice_flags = spflags;
+
+    return service::awaiter(this, entry, cancellation);
+}
+
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::pipes()
+    -> rcs::io::pipe_pool & { return *m_pipes; }
+
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::register_buffers(std::uint32_t capacity, std::uint32_t size)
+    -> rcs::io::buffer_arena & {
+    assert(m_arena == nullptr);
+
+    m_arena = std::make_unique<rcs::io::buffer_arena>(m_handle.descriptor(), capacity, size);
+
+    return *m_arena;
+}
+
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::buffers()
+    const -> rcs::io::buffer_arena * { return m_arena.get(); }
+
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::read_fixed(
+    std::int32_t descriptor, const rcs::io::slice &slice, std::uint32_t size, std::uint64_t offset, std::uint8_t flags)
+    -> service::awaiter {
+    assert(size <= slice.size());
+
+    rcs::io::uring::sqe entry;
+    entry.opcode     = rcs::io::uring::op::read_fixed;
+    entry.flags      = flags;
+    entry.descriptor = descriptor;
+    entry.buffer     = slice.data();
+    entry.bufsize    = size;
+    entry.offset     = offset;
+    entry.buf_index  = slice.index();
+
+    return service::awaiter(this, entry);
+}
+
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::write_fixed(
+    std::int32_t descriptor, const rcs::io::slice &slice, std::uint32_t size, std::uint64_t offset, std::uint8_t flags)
+    -> service::awaiter {
+    assert(size <= slice.size());
+
+    rcs::io::uring::sqe entry;
+    entry.opcode     = rcs::io::uring::op::write_fixed;
+    entry.flags      = flags;
+    entry.descriptor = descriptor;
+    entry.buffer     = slice.data();
+    entry.bufsize    = size;
+    entry.offset     = offset;
+    entry.buf_index  = slice.index();
+
+    return service::awaiter(this, entry);
+}
+
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::provide(std::uint32_t capacity, std::uint32_t size)
+    -> rcs::io::buffer_ring & {
+    if (not m_capabilities.buffer_rings()) throw rcs::system::exception(EOPNOTSUPP);
+
+    const std::unique_lock<std::mutex> lock(*m_rings.mutex);
+
+    const auto group = static_cast<std::uint16_t>(m_rings.list.size());
+    m_rings.list.push_back(std::make_unique<rcs::io::buffer_ring>(
+        m_handle.descriptor(), group, capacity, size));
+
+    return *m_rings.list.back();
+}
+
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::recv(
+    std::int32_t descriptor, rcs::io::buffer_ring &ring, rcs::io::lease &lease, std::uint8_t flags)
+    -> service::awaiter {
+    rcs::io::uring::sqe entry;
+    entry.opcode     = rcs::io::uring::op::recv;
+    entry.flags      = flags | rcs::io::uring::SQE_BUFFER_SELECT;
+    entry.descriptor = descriptor;
+    entry.bufsize    = ring.size();
+    entry.buf_group  = ring.group();
+
+    service::awaiter awaiter(this, entry);
+    awaiter.m_ring  = &ring;
+    awaiter.m_lease = &lease;
+    return awaiter;
+}
+
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::send_zc(
+    std::int32_t descriptor, const void *buffer, std::uint32_t size, std::uint8_t flags,
+    rcs::io::cancellation *cancellation)
+    -> service::awaiter {
+    // Kernels without zero-copy sends copy the buffer instead.
+    rcs::io::uring::sqe entry;
+    entry.opcode     = m_capabilities.zerocopy() ? rcs::io::uring::op::send_zc : rcs::io::uring::op::send;
+    entry.flags      = flags;
+    entry.descriptor = descriptor;
+    entry.buffer     = const_cast<void *>(buffer);
+    entry.bufsize    = size;
+    entry.msg_flags  = MSG_NOSIGNAL;
+
+    return service::awaiter(this, entry, cancellation);
+}
+
+template <rcs::execution::executor TExecutorType>
+void rcs::io::service<TExecutorType>::sink(service::sink_t sink) {
+    m_detached->sink = std::move(sink);
+}
+
+template <rcs::execution::executor TExecutorType>
+void rcs::io::service<TExecutorType>::write_detached(
+    std::int32_t descriptor, const void *buffer, std::uint32_t size, std::uint64_t offset, std::uint8_t flags) {
+    service::_detach(service::_write(descriptor, buffer, size, offset, flags));
+}
 
-    int ret = co_await awaiter{
-        .service    = this,
-        .descriptor = descriptor,
-        .buffer     = buffer,
-        .bufsize    = size,
-        .offset     = offset};
+template <rcs::execution::executor TExecutorType>
+void rcs::io::service<TExecutorType>::writev_detached(
+    std::int32_t descriptor, const struct ::iovec *vectors, std::uint32_t count, std::uint64_t offset,
+    std::uint8_t flags) {
+    service::_detach(service::_writev(descriptor, vectors, count, offset, flags));
+}
+
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::link()
+    -> service::chain { return service::chain(this); }
+
+template <rcs::execution::executor TExecutorType>
+template <typename TWork>
+void rcs::io::service<TExecutorType>::post(TWork &&work) {
+    service::_deliver(new service::posted<std::decay_t<TWork>>(std::forward<TWork>(work))); // NOLINT
+}
+
+template <rcs::execution::executor TExecutorType>
+template <typename TWork>
+void rcs::io::service<TExecutorType>::post(service &target, TWork &&work) {
+    auto *handler = new service::posted<std::decay_t<TWork>>(std::forward<TWork>(work)); // NOLINT
+    auto *courier = new service::courier(&target, handler);                               // NOLINT
+
+    rcs::io::uring::sqe entry;
+    entry.opcode     = rcs::io::uring::op::msg_ring;
+    entry.descriptor = target.m_handle.descriptor();
+    entry.offset     = reinterpret_cast<std::uint64_t>(static_cast<rcs::io::completion *>(handler));
+
+    // The target is busy from now on, so that it does not go idle before
+    // the message arrives.
+    target.m_pending.fetch_add(1);
+    service::_initiate(courier->initiate(entry));
+}
+
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::accept_multishot(std::int32_t descriptor, std::uint8_t flags)
+    -> service::stream {
+    rcs::io::uring::sqe entry;
+    entry.opcode     = rcs::io::uring::op::accept;
+    entry.flags      = flags;
+    entry.descriptor = descriptor;
+
+    // Without multishot support, a single-shot accept is re-armed after
+    // every connection.
+    if (m_capabilities.multishot()) entry.priority = rcs::io::uring::ACCEPT_MULTISHOT;
+
+    const typename service::stream::policy_t policy = {
+        // The kernel only terminates a healthy multishot accept if it could
+        // not post a completion event, in which case the accepted socket is
+        // still valid and the operation can simply be re-armed.
+        .rearm = [](std::int32_t result) { return result >= 0; },
+
+        // Close the connections accepted after the stream has been closed.
+        .discard = [](service *, const rcs::io::uring::sqe &, const rcs::io::uring::cqe &result) {
+            if (result.result >= 0) ::close(result.result);
+        }};
+
+    return service::stream(this, entry, policy);
+}
+
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::recv_multishot(
+    std::int32_t descriptor, rcs::io::buffer_ring &ring, std::uint8_t flags)
+    -> service::stream {
+    rcs::io::uring::sqe entry;
+    entry.opcode     = rcs::io::uring::op::recv;
+    entry.flags      = flags | rcs::io::uring::SQE_BUFFER_SELECT;
+    entry.descriptor = descriptor;
+    entry.buf_group  = ring.group();
+
+    // A multishot receive leaves the size up to the picked buffers.
+    if (m_capabilities.multishot_recv())
+        entry.priority = rcs::io::uring::RECV_MULTISHOT;
+    else
+        entry.bufsize = ring.size();
+
+    const typename service::stream::policy_t policy = {
+        // The kernel terminates a healthy multishot receive if it could not
+        // post a completion event, in which case the data it carries is
+        // still valid and the operation can simply be re-armed. Running out
+        // of buffers ends the stream like any other error.
+        .rearm = [](std::int32_t result) { return result > 0; },
+
+        // Hand the buffers received after the stream has been closed back
+        // to their ring.
+        .discard = [](service *owner, const rcs::io::uring::sqe &entry, const rcs::io::uring::cqe &result) {
+            if ((result.flags & rcs::io::uring::CQE_F_BUFFER) == 0) return;
+
+            // Leased for as long as it takes to hand it back, so that the
+            // ring keeps count of the buffers out.
+            const std::unique_lock<std::mutex> lock(*owner->m_rings.mutex);
+            const rcs::io::lease               discarded = owner->m_rings.list[entry.buf_group]->lease(
+                static_cast<std::uint16_t>(result.flags >> rcs::io::uring::CQE_BUFFER_SHIFT), 0);
+        }};
+
+    return service::stream(this, entry, policy);
+}
 
-    co_return ret;
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::register_files(std::uint32_t capacity)
+    -> rcs::io::file_table & {
+    assert(m_files == nullptr);
+
+    m_files = std::make_unique<rcs::io::file_table>(m_handle.descriptor(), capacity);
+
+    return *m_files;
 }
 
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::files()
+    const -> rcs::io::file_table * { return m_files.get(); }
+
 template <rcs::execution::executor TExecutorType>
 void rcs::io::service<TExecutorType>::run_one() {
     if (idle()) return;
+    if (not m_issuer.enabled) service::_enable();
+    if (service::queued() != 0) service::_admit();
+
+    const std::uint32_t submitnr = service::_flush();
 
     std::unique_lock<std::mutex> cqlock(*m_cq.mutex);
     rcs::io::uring::cqr         *cqr = &m_cq.r;
-    const rcs::io::uring::cqe   *cqe = nullptr;
-
-    if (cqr->empty())
-        cqr->wait(1);
-    cqe = &cqr->next();
-
-    auto work = [t = cqe->token, result = cqe->result] {
-        auto *token = reinterpret_cast<
-            rcs::io::token<int, std::coroutine_handle<>> *>(t);
 
-        token->result = result;
-        token->continuation.resume();
-    };
+    if (not service::_expecting(submitnr)) return;
+    (void)service::_wait(submitnr, nullptr);
+    const rcs::io::uring::cqe cqe = cqr->next();
 
     cqr->seen();
-    m_pending.fetch_sub(1);
+    if (service::_finishes(cqe))
+        m_pending.fetch_sub(1);
+    m_counters.reaps.fetch_add(1, std::memory_order::relaxed);
+    m_counters.completions.fetch_add(1, std::memory_order::relaxed);
     cqlock.unlock();
 
-    m_executor.execute(std::move(work));
+    if (service::queued() != 0) service::_admit();
+
+    service::_dispatch(cqe);
 }
 
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::run_batch(std::uint32_t max)
+    -> std::uint32_t { return service::_run(max, nullptr); }
+
 template <rcs::execution::executor TExecutorType>
 void rcs::io::service<TExecutorType>::run() {
-    while (not idle()) run_one();
+    while (not idle()) (void)run_batch(service::MAX_BATCH);
 }
 
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::run_for(std::chrono::nanoseconds duration)
+    -> std::uint64_t { return service::run_until(std::chrono::steady_clock::now() + duration); }
+
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::run_until(std::chrono::steady_clock::time_point deadline)
+    -> std::uint64_t {
+    std::uint64_t executed = 0;
+    while (not idle() and std::chrono::steady_clock::now() < deadline)
+        executed += service::_run(service::MAX_BATCH, &deadline);
+    return executed;
+}
+
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::_run(
+    std::uint32_t max, const std::chrono::steady_clock::time_point *deadline)
+    -> std::uint32_t {
+    if (idle() or max == 0) return 0;
+    if (not m_issuer.enabled) service::_enable();
+    if (service::queued() != 0) service::_admit();
+
+    std::array<rcs::io::uring::cqe, service::MAX_BATCH> entries;
+    const std::uint32_t submitnr = service::_flush();
+
+    std::unique_lock<std::mutex> cqlock(*m_cq.mutex);
+    rcs::io::uring::cqr         *cqr = &m_cq.r;
+
+    if (not service::_expecting(submitnr) or not service::_wait(submitnr, deadline)) return 0;
+    const std::uint32_t count =
+        cqr->next(entries.data(), std::min(max, service::MAX_BATCH));
+
+    // Publish the new head once for the whole batch.
+    cqr->seen();
+
+    std::uint32_t finished = 0;
+    for (std::uint32_t index = 0; index < count; ++index)
+        if (service::_finishes(entries[index])) ++finished;
+    m_pending.fetch_sub(finished);
+    m_counters.reaps.fetch_add(1, std::memory_order::relaxed);
+    m_counters.completions.fetch_add(count, std::memory_order::relaxed);
+    cqlock.unlock();
+
+    if (service::queued() != 0) service::_admit();
+
+    for (std::uint32_t index = 0; index < count; ++index)
+        service::_dispatch(entries[index]);
+
+    return count;
+}
+
+template <rcs::execution::executor TExecutorType>
+void rcs::io::service<TExecutorType>::_enable() {
+    (void)rcs::io::uring::register_(
+        m_handle.descriptor(), rcs::io::uring::reg::enable_rings, nullptr, 0);
+    m_issuer.enabled = true;
+
+    // Registering the descriptor is merely an optimization.
+    try {
+        m_issuer.registered = rcs::io::uring::register_ring(m_handle.descriptor());
+    } catch (const rcs::system::exception &) {
+        return;
+    }
+
+    m_sq.r.registered(m_issuer.registered);
+    m_cq.r.registered(m_issuer.registered);
+}
+
+template <rcs::execution::executor TExecutorType>
+void rcs::io::service<TExecutorType>::_arm() {
+    if (m_wakeup->handle.descriptor() == -1 or m_wakeup->armed.load()) return;
+
+    // The poll goes ahead of everything else, making room if need be.
+    if (m_sq.r.pending() == m_sq.r.capacity()) {
+        const std::uint32_t consumed = m_sq.r.submit();
+        m_counters.enters.fetch_add(1, std::memory_order::relaxed);
+        m_counters.submitted.fetch_add(consumed, std::memory_order::relaxed);
+        if (consumed == 0) return;
+    }
+
+    rcs::io::uring::sqe *sqe = &m_sq.r.next();
+
+    *sqe       = service::_poll(m_wakeup->handle.descriptor(), POLLIN, 0);
+    sqe->token = reinterpret_cast<std::uint64_t>(m_wakeup.get());
+
+    m_wakeup->armed.store(true);
+}
+
+template <rcs::execution::executor TExecutorType>
+void rcs::io::service<TExecutorType>::_rearm() {
+    // Whatever is written from now on fires the next poll right away.
+    ::eventfd_t value = 0;
+    (void)::eventfd_read(m_wakeup->handle.descriptor(), &value);
+    m_wakeup->armed.store(false);
+}
+
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::_expecting(std::uint32_t submitnr)
+    -> bool {
+    if (m_pending.load() != 0 or not m_cq.r.empty()) return true;
+    if (submitnr != 0) service::_enter(submitnr, 0);
+    return false;
+}
+
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::_wait(
+    std::uint32_t submitnr, const std::chrono::steady_clock::time_point *deadline)
+    -> bool {
+    using clock = std::chrono::steady_clock;
+
+    // The clock is only read every so often while spinning.
+    static constexpr std::uint32_t SPIN_STRIDE = 64;
+
+    rcs::io::uring::cqr *cqr = &m_cq.r;
+
+    // Pending task work posts its completions once the kernel is entered
+    // for them, which is the only way they arrive with deferred task work.
+    const auto ready = [&]() {
+        if (cqr->empty() and m_sq.r.taskrun()) cqr->wait(0);
+        return not cqr->empty();
+    };
+
+    if (ready()) {
+        if (submitnr != 0) service::_enter(submitnr, 0);
+        return true;
+    }
+
+    if (m_options.wait.spin > std::chrono::nanoseconds::zero()) {
+        if (submitnr != 0) service::_enter(std::exchange(submitnr, 0), 0);
+
+        clock::time_point until = clock::now() + m_options.wait.spin;
+        if (deadline != nullptr) until = std::min(until, *deadline);
+
+        for (std::uint32_t spins = 1; not ready(); ++spins)
+            if (spins % SPIN_STRIDE == 0 and clock::now() >= until) break;
+        if (not cqr->empty()) return true;
+    }
+
+    if (deadline == nullptr) {
+        if (submitnr != 0)
+            service::_enter(submitnr, 1);
+        else
+            cqr->wait(1);
+        return true;
+    }
+
+    const clock::duration remaining = *deadline - clock::now();
+    if (remaining <= clock::duration::zero()) {
+        if (submitnr != 0) service::_enter(submitnr, 0);
+        return ready();
+    }
+
+    // Kernels that cannot time out a wait have the queue polled instead.
+    if (not m_capabilities.timed_wait()) {
+        if (submitnr != 0) service::_enter(submitnr, 0);
+        while (not ready() and clock::now() < *deadline)
+            std::this_thread::sleep_for(std::min<clock::duration>(*deadline - clock::now(), std::chrono::milliseconds(1)));
+        return not cqr->empty();
+    }
+
+    const auto timeout = rcs::io::uring::timespec::from(remaining);
+    if (submitnr != 0) return service::_enter(submitnr, 1, timeout) or not cqr->empty();
+    return cqr->wait(1, timeout) or not cqr->empty();
+}
+
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::_flush()
+    -> std::uint32_t {
+    if (m_options.submission != rcs::io::submission::deferred) return 0;
+
+    service::_own();
+    service::_arm();
+    service::_process();
+
+    // Requests left over once the submission queue filled up are staged as
+    // soon as the kernel has consumed the entries ahead of them.
+    while (not m_admission.overflow.empty()) {
+        const std::uint32_t consumed = m_sq.r.submit();
+        m_counters.enters.fetch_add(1, std::memory_order::relaxed);
+        m_counters.submitted.fetch_add(consumed, std::memory_order::relaxed);
+        if (consumed == 0) std::this_thread::yield();
+        service::_process();
+    }
+
+    std::uint32_t submitnr = 0;
+    if (m_sq.r.staged() != 0) {
+        // The polling thread picks the entries up, there is nothing left to
+        // be submitted by the event processing loop.
+        if (m_sq.r.polled())
+            service::_publish();
+        else
+            submitnr = m_sq.r.flush();
+    }
+    m_detached->deferred.store(0);
+
+    service::_disown();
+    return submitnr;
+}
+
+template <rcs::execution::executor TExecutorType>
+void rcs::io::service<TExecutorType>::_dispatch(const rcs::io::uring::cqe &cqe) {
+    // The wakeup has done its job by completing, and must be reset before
+    // the loop flushes again.
+    if (cqe.token == reinterpret_cast<std::uint64_t>(m_wakeup.get())) {
+        service::_rearm();
+        return;
+    }
+
+    auto work = [t = cqe.token, result = cqe.result, flags = cqe.flags] {
+        auto *handler = reinterpret_cast<rcs::io::completion *>(t);
+        handler->complete(result, flags);
+    };
+
+    m_executor.execute(std::move(work));
+}
+
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::_finishes(const rcs::io::uring::cqe &cqe)
+    const -> bool {
+    if ((cqe.flags & rcs::io::uring::CQE_F_MORE) != 0) return false;
+    if (cqe.token == reinterpret_cast<std::uint64_t>(m_wakeup.get())) return false;
+
+    // Detached operations only count as pending if their successes are
+    // posted as well.
+    return cqe.token != reinterpret_cast<std::uint64_t>(m_detached.get()) or
+           not m_capabilities.skip_success();
+}
+
+template <rcs::execution::executor TExecutorType>
+void rcs::io::service<TExecutorType>::_initiate(struct request_t &request) {
+    m_queued.fetch_add(1);
+    m_sq.staging->requests.push(&request);
+    service::_combine();
+}
+
+template <rcs::execution::executor TExecutorType>
+void rcs::io::service<TExecutorType>::_combine() {
+    // The request may already have been processed by the previous owner,
+    // along with its own.
+    const std::lock_guard<std::mutex> lock(m_sq.staging->mutex);
+    service::_process();
+}
+
+template <rcs::execution::executor TExecutorType>
+void rcs::io::service<TExecutorType>::_own() {
+    m_sq.staging->mutex.lock();
+}
+
+template <rcs::execution::executor TExecutorType>
+void rcs::io::service<TExecutorType>::_disown() {
+    m_sq.staging->mutex.unlock();
+}
+
+template <rcs::execution::executor TExecutorType>
+void rcs::io::service<TExecutorType>::_process() {
+    std::uint32_t staged = 0;
+
+    while (not m_admission.overflow.empty()) {
+        auto *owned = static_cast<struct owned_t *>(m_admission.overflow.front());
+        if (not service::_room(static_cast<std::uint32_t>(owned->links.size()))) break;
+
+        service::_stage(owned->links);
+        m_admission.overflow.pop_front();
+        m_queued.fetch_sub(1);
+        ++staged;
+
+        delete owned; // NOLINT
+    }
+
+    while (m_sq.staging->requests.size() != 0) {
+        struct request_t *request = m_sq.staging->requests.pop();
+        if (request == nullptr) continue;
+
+        if (request->owned) {
+            auto *owned = static_cast<struct owned_t *>(request);
+
+            // An operation still waiting for admission is taken out of the
+            // queue. Its completion is deferred to the event processing
+            // loop, which is woken up by the completion of the cancellation
+            // request.
+            const auto held = std::ranges::find_if(m_admission.queue, [owned](const struct request_t *h) {
+                return reinterpret_cast<std::uint64_t>(h->links.front().handler) == owned->target;
+            });
+            if (owned->target != 0 and held != m_admission.queue.end()) {
+                m_admission.cancelled.push_back((*held)->links.front().handler);
+                m_admission.queue.erase(held);
+            }
+
+            // Cancellation requests bypass the admission queue, since the
+            // operations they target may be the ones holding up the slots.
+            // They only wait for room in the submission queue.
+            if (not m_admission.overflow.empty() or
+                not service::_room(static_cast<std::uint32_t>(owned->links.size()))) {
+                m_admission.overflow.push_back(owned);
+                continue;
+            }
+
+            service::_stage(owned->links);
+            m_queued.fetch_sub(1);
+            ++staged;
+
+            delete owned; // NOLINT
+            continue;
+        }
+
+        // Hold the operation back if the service is at capacity, or if other
+        // operations are already waiting, so that they are admitted in order.
+        const auto slots = static_cast<std::uint32_t>(request->links.size());
+        if (not m_admission.queue.empty() or not service::_fits(slots) or not service::_room(slots)) {
+            m_admission.queue.push_back(request);
+            m_counters.admissions.fetch_add(1, std::memory_order::relaxed);
+            continue;
+        }
+
+        service::_stage(request->links);
+        m_queued.fetch_sub(1);
+        ++staged;
+    }
+
+    std::uint32_t admitted = 0;
+    while (not m_admission.queue.empty()) {
+        const struct request_t *held  = m_admission.queue.front();
+        const auto              slots = static_cast<std::uint32_t>(held->links.size());
+        if (not service::_fits(slots) or not service::_room(slots)) break;
+        service::_stage(held->links);
+        m_admission.queue.pop_front();
+        ++admitted;
+    }
+    m_queued.fetch_sub(admitted);
+
+    if (staged + admitted != 0) service::_submit();
+}
+
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::_fits(std::uint32_t slots)
+    const -> bool {
+    // An idle service admits anything the submission queue can hold, so
+    // that operations taking more slots than there are cannot be held back
+    // forever.
+    const std::uint32_t pending = m_pending.load();
+    return pending == 0 or pending + slots <= m_bandwidth.load();
+}
+
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::_room(std::uint32_t slots)
+    -> bool {
+    if (m_sq.r.capacity() - m_sq.r.pending() >= slots) return true;
+
+    // Whoever stages may run on another thread than the single issuer, and
+    // leaves the submission to the event processing loop. Submitting makes
+    // no room unless something has been staged.
+    if (m_options.submission == rcs::io::submission::deferred) return false;
+    if (m_sq.r.staged() == 0) return false;
+
+    const std::uint32_t consumed = m_sq.r.submit();
+    m_counters.enters.fetch_add(1, std::memory_order::relaxed);
+    m_counters.submitted.fetch_add(consumed, std::memory_order::relaxed);
+    return m_sq.r.capacity() - m_sq.r.pending() >= slots;
+}
+
+template <rcs::execution::executor TExecutorType>
+void rcs::io::service<TExecutorType>::_stage(std::span<const struct link_t> links) {
+    const auto slots = static_cast<std::uint32_t>(links.size());
+    assert(slots != 0 and slots <= m_sq.r.capacity());
+
+    // Linked entries must be staged at once, since the link is severed at a
+    // submission boundary.
+    assert(m_sq.r.capacity() - m_sq.r.pending() >= slots);
+
+    constexpr std::uint8_t LINKS = rcs::io::uring::SQE_IO_LINK | rcs::io::uring::SQE_IO_HARDLINK;
+
+    std::uint32_t counted = slots;
+    for (std::size_t index = 0; index < links.size(); ++index) {
+        rcs::io::uring::sqe *sqe = &m_sq.r.next();
+
+        *sqe       = links[index].entry;
+        sqe->token = reinterpret_cast<std::uint64_t>(links[index].handler);
+
+        // Entries keep a hard link if they have one. The last entry must not
+        // be linked to whatever is staged next.
+        if (index + 1 == links.size())
+            sqe->flags &= static_cast<std::uint8_t>(~LINKS);
+        else if ((sqe->flags & LINKS) == 0)
+            sqe->flags |= rcs::io::uring::SQE_IO_LINK;
+
+        if ((sqe->flags & rcs::io::uring::SQE_CQE_SKIP_SUCCESS) != 0) --counted;
+    }
+
+    if (m_options.submission == rcs::io::submission::deferred)
+        m_detached->deferred.fetch_add(slots - counted);
+    m_pending.fetch_add(counted);
+}
+
+template <rcs::execution::executor TExecutorType>
+void rcs::io::service<TExecutorType>::_admit() {
+    std::vector<rcs::io::completion *> cancelled;
+
+    service::_own();
+    service::_process();
+    cancelled.swap(m_admission.cancelled);
+    service::_disown();
+
+    // The cancelled operations never reached the kernel, so they are
+    // completed right here.
+    for (rcs::io::completion *handler : cancelled) {
+        m_queued.fetch_sub(1);
+        m_executor.execute([handler] { handler->complete(-ECANCELED, 0); });
+    }
+}
+
+template <rcs::execution::executor TExecutorType>
+void rcs::io::service<TExecutorType>::_cancel(std::uint64_t token) {
+    rcs::io::uring::sqe entry;
+    entry.opcode = rcs::io::uring::op::async_cancel;
+    entry.target = token;
+
+    service::_bypass(entry, &m_discard, token);
+}
+
+template <rcs::execution::executor TExecutorType>
+void rcs::io::service<TExecutorType>::_bypass(
+    const rcs::io::uring::sqe &entry, rcs::io::completion *handler, std::uint64_t target) {
+    auto *request = new struct owned_t; // NOLINT
+
+    request->link   = {.entry = entry, .handler = handler};
+    request->links  = std::span(&request->link, 1);
+    request->target = target;
+    request->owned  = true;
+
+    // Released by the owner of the submission queue once staged.
+    m_queued.fetch_add(1);
+    m_sq.staging->requests.push(request);
+    service::_combine();
+}
+
+template <rcs::execution::executor TExecutorType>
+void rcs::io::service<TExecutorType>::_deliver(rcs::io::completion *handler) {
+    m_pending.fetch_add(1);
+
+    if (m_capabilities.direct_messages()) {
+        try {
+            rcs::io::uring::msg_ring(m_handle.descriptor(), reinterpret_cast<std::uint64_t>(handler), 0);
+            return;
+        } catch (const rcs::system::exception &) {
+            // A ring not enabled yet cannot be messaged, but its loop has
+            // yet to flush.
+        }
+    }
+
+    // Kernels older than 6.13 cannot message a ring without a ring of one's
+    // own, in which case a no-op on the ring itself does the job.
+    service::_bypass(rcs::io::uring::sqe{}, handler);
+    m_pending.fetch_sub(1);
+
+    // With deferred submission, the no-op is only staged, and the loop may
+    // be waiting for something else.
+    if (m_wakeup->handle.descriptor() != -1) (void)::eventfd_write(m_wakeup->handle.descriptor(), 1);
+}
+
+template <rcs::execution::executor TExecutorType>
+void rcs::io::service<TExecutorType>::_ignore(
+    rcs::io::completion *self, std::int32_t result, std::uint32_t flags) {
+    (void)self, (void)result, (void)flags;
+}
+
+template <rcs::execution::executor TExecutorType>
+void rcs::io::service<TExecutorType>::_detach(rcs::io::uring::sqe entry) {
+    if (m_capabilities.skip_success()) entry.flags |= rcs::io::uring::SQE_CQE_SKIP_SUCCESS;
+
+    // Detached operations bypass the admission queue, since they take no
+    // slot unless they fail.
+    service::_bypass(entry, m_detached.get());
+}
+
+template <rcs::execution::executor TExecutorType>
+void rcs::io::service<TExecutorType>::_fail(
+    rcs::io::completion *self, std::int32_t result, std::uint32_t flags) {
+    (void)flags;
+    if (result >= 0) return;
+
+    auto *detached = static_cast<struct detached_t *>(self);
+    detached->failures.fetch_add(1, std::memory_order::relaxed);
+    if (detached->sink) detached->sink(result);
+}
+
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::_connect(
+    std::int32_t descriptor, const struct ::sockaddr &address, std::uint32_t size, std::uint8_t flags)
+    -> rcs::io::uring::sqe {
+    rcs::io::uring::sqe entry;
+    entry.opcode     = rcs::io::uring::op::connect;
+    entry.flags      = flags;
+    entry.descriptor = descriptor;
+    entry.address    = const_cast<struct ::sockaddr *>(&address);
+    entry.addrlen    = size;
+
+    return entry;
+}
+
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::_read(
+    std::int32_t descriptor, void *buffer, std::uint32_t size, std::uint64_t offset, std::uint8_t flags)
+    -> rcs::io::uring::sqe {
+    rcs::io::uring::sqe entry;
+    entry.opcode     = rcs::io::uring::op::read;
+    entry.flags      = flags;
+    entry.descriptor = descriptor;
+    entry.buffer     = buffer;
+    entry.bufsize    = size;
+    entry.offset     = offset;
+
+    return entry;
+}
+
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::_write(
+    std::int32_t descriptor, const void *buffer, std::uint32_t size, std::uint64_t offset, std::uint8_t flags)
+    -> rcs::io::uring::sqe {
+    rcs::io::uring::sqe entry;
+    entry.opcode     = rcs::io::uring::op::write;
+    entry.flags      = flags;
+    entry.descriptor = descriptor;
+    entry.buffer     = const_cast<void *>(buffer);
+    entry.bufsize    = size;
+    entry.offset     = offset;
+
+    return entry;
+}
+
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::_readv(
+    std::int32_t descriptor, const struct ::iovec *vectors, std::uint32_t count, std::uint64_t offset,
+    std::uint8_t flags)
+    -> rcs::io::uring::sqe {
+    rcs::io::uring::sqe entry;
+    entry.opcode     = rcs::io::uring::op::readv;
+    entry.flags      = flags;
+    entry.descriptor = descriptor;
+    entry.iov        = const_cast<struct ::iovec *>(vectors);
+    entry.iovnr      = count;
+    entry.offset     = offset;
+
+    return entry;
+}
+
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::_writev(
+    std::int32_t descriptor, const struct ::iovec *vectors, std::uint32_t count, std::uint64_t offset,
+    std::uint8_t flags)
+    -> rcs::io::uring::sqe {
+    rcs::io::uring::sqe entry;
+    entry.opcode     = rcs::io::uring::op::writev;
+    entry.flags      = flags;
+    entry.descriptor = descriptor;
+    entry.iov        = const_cast<struct ::iovec *>(vectors);
+    entry.iovnr      = count;
+    entry.offset     = offset;
+
+    return entry;
+}
+
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::_sendmsg(
+    std::int32_t descriptor, const struct ::msghdr &message, std::uint32_t msgflags, std::uint8_t flags)
+    -> rcs::io::uring::sqe {
+    rcs::io::uring::sqe entry;
+    entry.opcode     = rcs::io::uring::op::sendmsg;
+    entry.flags      = flags;
+    entry.descriptor = descriptor;
+    entry.msg        = const_cast<struct ::msghdr *>(&message);
+    entry.iovnr      = 1;
+    entry.msg_flags  = msgflags;
+
+    return entry;
+}
+
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::_recvmsg(
+    std::int32_t descriptor, struct ::msghdr &message, std::uint32_t msgflags, std::uint8_t flags)
+    -> rcs::io::uring::sqe {
+    rcs::io::uring::sqe entry;
+    entry.opcode     = rcs::io::uring::op::recvmsg;
+    entry.flags      = flags;
+    entry.descriptor = descriptor;
+    entry.msg        = &message;
+    entry.iovnr      = 1;
+    entry.msg_flags  = msgflags;
+
+    return entry;
+}
+
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::_poll(std::int32_t descriptor, std::uint32_t events, std::uint8_t flags)
+    -> rcs::io::uring::sqe {
+    rcs::io::uring::sqe entry;
+    entry.opcode      = rcs::io::uring::op::poll_add;
+    entry.flags       = flags;
+    entry.descriptor  = descriptor;
+    entry.poll_events = events;
+
+    return entry;
+}
+
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::_splice(
+    std::int32_t in, std::int64_t inoffset, std::int32_t out, std::int64_t outoffset, std::uint32_t size,
+    std::uint32_t spflags, std::uint8_t flags)
+    -> rcs::io::uring::sqe {
+    rcs::io::uring::sqe entry;
+    entry.opcode        = rcs::io::uring::op::splice;
+    entry.flags         = flags;
+    entry.descriptor    = out;
+    entry.offset        = static_cast<std::uint64_t>(outoffset);
+    entry.splice_in     = in;
+    entry.splice_offset = static_cast<std::uint64_t>(inoffset);
+    entry.bufsize       = size;
+    entry.splice_flags  = spflags;
+
+    return entry;
+}
+
+template <rcs::execution::executor TExecutorType>
+void rcs::io::service<TExecutorType>::_submit() {
+    if (m_options.submission == rcs::io::submission::deferred) return;
+
+    if (m_sq.r.polled()) {
+        service::_publish();
+        return;
+    }
+
+    const std::uint32_t consumed = m_sq.r.submit();
+    m_counters.enters.fetch_add(1, std::memory_order::relaxed);
+    m_counters.submitted.fetch_add(consumed, std::memory_order::relaxed);
+}
+
+template <rcs::execution::executor TExecutorType>
+void rcs::io::service<TExecutorType>::_publish() {
+    const std::uint64_t wakeups  = m_sq.r.wakeups();
+    const std::uint32_t consumed = m_sq.r.submit();
+    m_counters.enters.fetch_add(m_sq.r.wakeups() - wakeups, std::memory_order::relaxed);
+    m_counters.submitted.fetch_add(consumed, std::memory_order::relaxed);
+}
+
+template <rcs::execution::executor TExecutorType>
+void rcs::io::service<TExecutorType>::_enter(std::uint32_t submitnr, std::uint32_t waitnr) {
+    const bool          registered = m_issuer.registered >= 0;
+    const std::uint32_t consumed   = rcs::io::uring::enter(
+        registered ? m_issuer.registered : m_handle.descriptor(), submitnr, waitnr,
+        (waitnr != 0 ? rcs::io::uring::ENTER_GETEVENTS : 0) |
+            (registered ? rcs::io::uring::ENTER_REGISTERED_RING : 0),
+        nullptr);
+    m_counters.enters.fetch_add(1, std::memory_order::relaxed);
+    m_counters.submitted.fetch_add(consumed, std::memory_order::relaxed);
+}
+
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service<TExecutorType>::_enter(
+    std::uint32_t submitnr, std::uint32_t waitnr, const rcs::io::uring::timespec &timeout)
+    -> bool {
+    rcs::io::uring::getevents_arg arg;
+    arg.ts = reinterpret_cast<std::uint64_t>(&timeout);
+
+    const bool    registered = m_issuer.registered >= 0;
+    std::uint32_t consumed   = 0;
+    bool          expired    = false;
+    try {
+        consumed = rcs::io::uring::enter(
+            registered ? m_issuer.registered : m_handle.descriptor(), submitnr, waitnr,
+            rcs::io::uring::ENTER_GETEVENTS | rcs::io::uring::ENTER_EXT_ARG |
+                (registered ? rcs::io::uring::ENTER_REGISTERED_RING : 0),
+            arg);
+    } catch (const rcs::system::exception &e) {
+        if (e.error_code() != ETIME) throw;
+        expired = true;
+    }
+
+    m_counters.enters.fetch_add(1, std::memory_order::relaxed);
+    m_counters.submitted.fetch_add(consumed, std::memory_order::relaxed);
+    return not expired;
+}
+
+template <rcs::execution::executor TExecutorType>
+class rcs::io::service<TExecutorType>::awaiter final
+    : public rcs::io::completion {
+    friend class service;
+
+  public:
+    awaiter(const awaiter &)                     = delete;
+    auto operator=(const awaiter &) -> awaiter & = delete;
+    auto operator=(awaiter &&) -> awaiter      & = delete;
+
+  public:
+    /// @brief Construct an awaiter of the operation described by an entry.
+    awaiter(service *owner, const rcs::io::uring::sqe &entry,
+            rcs::io::cancellation *cancellation = nullptr)
+        : rcs::io::completion(&awaiter::_complete),
+          m_service(owner), m_entry(entry), m_cancellation(cancellation) {}
+
+    /// @brief Construct an awaiter of the operation described by an entry,
+    ///        which times out after the specified duration.
+    awaiter(service *owner, const rcs::io::uring::sqe &entry,
+            std::chrono::nanoseconds timeout, rcs::io::cancellation *cancellation = nullptr)
+        : awaiter(owner, entry, cancellation) {
+        m_timeout = rcs::io::uring::timespec::from(timeout);
+        m_timed   = true;
+    }
+
+    ///
+    /// @brief   Construct from an awaiter that has not been awaited yet.
+    ///
+    /// @details Awaiters are returned by value and awaited in place, so
+    ///          that an operation allocates nothing. Once awaited, an
+    ///          awaiter is referenced by the kernel and must not be moved.
+    ///
+    awaiter(awaiter &&other) noexcept
+        : rcs::io::completion(&awaiter::_complete),
+          m_service(other.m_service), m_entry(other.m_entry), m_cancellation(other.m_cancellation),
+          m_timeout(other.m_timeout), m_timed(other.m_timed), m_addrlen(other.m_addrlen),
+          m_ring(other.m_ring), m_lease(other.m_lease) {}
+
+    /// @brief Default destructor.
+    ~awaiter() = default;
+
+  public:
+    /// @brief Get the flags of the completion queue event.
+    [[nodiscard]] auto flags() const -> std::uint32_t { return m_flags; }
+
+  public:
+    auto await_ready() const -> bool { return false; }
+    auto await_resume() const -> std::int32_t { return m_token.result; }
+
+    void await_suspend(std::coroutine_handle<> caller) {
+        m_token.result       = -1;
+        m_token.continuation = caller;
+        m_flags              = 0;
+
+        m_service->m_executor.execute([this]() {
+            // The awaiter may be gone as soon as the operation is initiated.
+            service               *owner        = m_service;
+            rcs::io::cancellation *cancellation = m_cancellation;
+            const std::uint64_t    token        = reinterpret_cast<std::uint64_t>(this);
+
+            // Attach before initiating, so that the operation cannot be
+            // completed while still unknown to the cancellation handle.
+            if (cancellation != nullptr)
+                cancellation->attach(&awaiter::_cancel, owner, token);
+
+            // The address length is updated in place by the kernel.
+            if (m_addrlen.has_value()) m_entry.addrlen2 = &*m_addrlen;
+
+            m_links[0] = {.entry = m_entry, .handler = this};
+            if (m_timed) {
+                m_links[1].entry.opcode  = rcs::io::uring::op::link_timeout;
+                m_links[1].entry.timeout = &m_timeout;
+                m_links[1].entry.bufsize = 1;
+                m_links[1].handler       = &m_service->m_discard;
+            }
+
+            m_request.links = std::span(m_links.data(), m_timed ? 2 : 1);
+            m_service->_initiate(m_request);
+
+            // A cancellation requested earlier, or while the operation was
+            // being initiated, might have missed the operation.
+            if (cancellation != nullptr and cancellation->requested())
+                owner->_cancel(token);
+        });
+    }
+
+  private:
+    /// @brief Resume the awaiting coroutine with the operation result.
+    static void _complete(rcs::io::completion *self, std::int32_t result, std::uint32_t flags) {
+        auto *awaiter = static_cast<service::awaiter *>(self);
+
+        // A zero-copy send posts its result ahead of the notification, and
+        // the awaiting coroutine is only resumed once the latter arrives.
+        if ((flags & rcs::io::uring::CQE_F_NOTIF) != 0) {
+            awaiter->m_token.continuation.resume();
+            return;
+        }
+
+        bool cancelled = false;
+        if (awaiter->m_cancellation != nullptr) {
+            awaiter->m_cancellation->detach();
+            cancelled = awaiter->m_cancellation->requested();
+        }
+
+        // The linked timeout cancels the operation once it expires.
+        if (awaiter->m_timed and result == -ECANCELED and not cancelled)
+            result = -ETIME;
+
+        awaiter->m_token.result = result;
+        awaiter->m_flags        = flags;
+        if ((flags & rcs::io::uring::CQE_F_MORE) != 0) return;
+
+        if (awaiter->m_lease != nullptr and (flags & rcs::io::uring::CQE_F_BUFFER) != 0) {
+            const auto index = static_cast<std::uint16_t>(flags >> rcs::io::uring::CQE_BUFFER_SHIFT);
+            *awaiter->m_lease = awaiter->m_ring->lease(index, result > 0 ? static_cast<std::uint32_t>(result) : 0);
+        }
+
+        awaiter->m_token.continuation.resume();
+    }
+
+    /// @brief Request cancellation of an operation of a service.
+    static void _cancel(void *context, std::uint64_t token) {
+        static_cast<service *>(context)->_cancel(token);
+    }
+
+  private:
+    /// @brief I/O service.
+    service *m_service = nullptr;
+
+    /// @brief Operation description.
+    rcs::io::uring::sqe m_entry = {};
+
+    /// @brief Asynchronous completion token.
+    rcs::io::token<std::int32_t, std::coroutine_handle<>> m_token = {-1, nullptr};
+
+    /// @brief Flags of the completion queue event.
+    std::uint32_t m_flags = 0;
+
+    /// @brief Cancellation handle, if any.
+    rcs::io::cancellation *m_cancellation = nullptr;
+
+    /// @brief Linked timeout.
+    rcs::io::uring::timespec m_timeout = {};
+
+    /// @brief Whether the operation is linked to a timeout.
+    bool m_timed = false;
+
+    /// @brief Address length of an accepted connection, if any.
+    std::optional<std::uint32_t> m_addrlen;
+
+    /// @brief Ring a received buffer is picked from, if any.
+    rcs::io::buffer_ring *m_ring = nullptr;
+
+    /// @brief Lease of a received buffer, if any.
+    rcs::io::lease *m_lease = nullptr;
+
+    /// @brief Staged entries.
+    std::array<struct service::link_t, 2> m_links = {};
+
+    /// @brief Staging request.
+    struct service::request_t m_request = {};
+};
+
+template <rcs::execution::executor TExecutorType>
+template <typename TWork>
+class rcs::io::service<TExecutorType>::posted final
+    : public rcs::io::completion {
+  public:
+    /// @brief Construct from a unit of work.
+    template <typename TWork_>
+    explicit posted(TWork_ &&work)
+        : rcs::io::completion(&posted::_complete), m_work(std::forward<TWork_>(work)) {}
+
+  private:
+    /// @brief Run the work and release the completion.
+    static void _complete(rcs::io::completion *self, std::int32_t result, std::uint32_t flags) {
+        const std::unique_ptr<posted> handler(static_cast<posted *>(self));
+        (void)result, (void)flags;
+        handler->m_work();
+    }
+
+  private:
+    /// @brief Unit of work.
+    TWork m_work;
+};
+
+template <rcs::execution::executor TExecutorType>
+class rcs::io::service<TExecutorType>::courier final
+    : public rcs::io::completion {
+  public:
+    /// @brief Construct a courier of a completion handler to a service.
+    courier(service *target, rcs::io::completion *handler)
+        : rcs::io::completion(&courier::_complete), m_target(target), m_handler(handler) {}
+
+  public:
+    /// @brief Get the request staging the message described by an entry.
+    auto initiate(const rcs::io::uring::sqe &entry) -> struct service::request_t & {
+        m_link          = {.entry = entry, .handler = this};
+        m_request.links = std::span(&m_link, 1);
+        return m_request;
+    }
+
+  private:
+    /// @brief Release the courier, delivering the handler by other means if
+    ///        the message did not get through.
+    static void _complete(rcs::io::completion *self, std::int32_t result, std::uint32_t flags) {
+        const std::unique_ptr<courier> c(static_cast<courier *>(self));
+        (void)flags;
+
+        if (result >= 0) return;
+        c->m_target->m_pending.fetch_sub(1);
+        c->m_target->_deliver(c->m_handler);
+    }
+
+  private:
+    /// @brief Receiving service.
+    service *m_target = nullptr;
+
+    /// @brief Delivered completion handler.
+    rcs::io::completion *m_handler = nullptr;
+
+    /// @brief Staged entry.
+    struct service::link_t m_link = {};
+
+    /// @brief Staging request.
+    struct service::request_t m_request = {};
+};
+
+///
+/// @brief   Sequence of linked operations.
+///
+/// @details Each operation starts once the previous one has completed in
+///          full. Once an operation fails or falls short, the remaining
+///          ones complete with -ECANCELED, unless the failed operation has
+///          been marked with `hard()`. The operations are admitted and
+///          submitted together, and the awaiting coroutine is resumed once,
+///          after every one of them has completed.
+///
+///          Buffers and addresses must stay valid until the chain has been
+///          awaited. A chain with more operations than the submission queue
+///          holds is never submitted; each of its operations completes with
+///          -EINVAL.
+///
+template <rcs::execution::executor TExecutorType>
+class rcs::io::service<TExecutorType>::chain final {
+  private:
+    class step_t;
+
+  public:
+    chain(const chain &)                     = delete;
+    chain(chain &&)                          = delete;
+    auto operator=(const chain &) -> chain & = delete;
+    auto operator=(chain &&) -> chain      & = delete;
+
+  public:
+    /// @brief Construct an empty chain of operations of a service.
+    explicit chain(service *owner)
+        : m_service(owner) {}
+
+    /// @brief Default destructor.
+    ~chain() = default;
+
+  public:
+    /// @brief Append an initiation of a connection to a socket.
+    auto connect(std::int32_t descriptor, const struct ::sockaddr &address, std::uint32_t size,
+                 std::uint8_t flags = 0) -> chain & {
+        return chain::_append(service::_connect(descriptor, address, size, flags));
+    }
+
+    /// @brief Append a read from a file descriptor into a specified buffer.
+    auto read(std::int32_t descriptor, void *buffer, std::uint32_t size, std::uint64_t offset = 0,
+              std::uint8_t flags = 0) -> chain & {
+        return chain::_append(service::_read(descriptor, buffer, size, offset, flags));
+    }
+
+    /// @brief Append a write to a file descriptor from a specified buffer.
+    auto write(std::int32_t descriptor, const void *buffer, std::uint32_t size, std::uint64_t offset = 0,
+               std::uint8_t flags = 0) -> chain & {
+        return chain::_append(service::_write(descriptor, buffer, size, offset, flags));
+    }
+
+    /// @brief Append a read from a file descriptor into multiple buffers.
+    auto readv(std::int32_t descriptor, const struct ::iovec *vectors, std::uint32_t count,
+               std::uint64_t offset = 0, std::uint8_t flags = 0) -> chain & {
+        return chain::_append(service::_readv(descriptor, vectors, count, offset, flags));
+    }
+
+    /// @brief Append a write to a file descriptor from multiple buffers.
+    auto writev(std::int32_t descriptor, const struct ::iovec *vectors, std::uint32_t count,
+                std::uint64_t offset = 0, std::uint8_t flags = 0) -> chain & {
+        return chain::_append(service::_writev(descriptor, vectors, count, offset, flags));
+    }
+
+    /// @brief Append a message sent to a socket.
+    auto sendmsg(std::int32_t descriptor, const struct ::msghdr &message, std::uint32_t msgflags = 0,
+                 std::uint8_t flags = 0) -> chain & {
+        return chain::_append(service::_sendmsg(descriptor, message, msgflags, flags));
+    }
+
+    /// @brief Append a message received from a socket.
+    auto recvmsg(std::int32_t descriptor, struct ::msghdr &message, std::uint32_t msgflags = 0,
+                 std::uint8_t flags = 0) -> chain & {
+        return chain::_append(service::_recvmsg(descriptor, message, msgflags, flags));
+    }
+
+    /// @brief Append a wait for a descriptor to become ready.
+    auto poll(std::int32_t descriptor, std::uint32_t events, std::uint8_t flags = 0) -> chain & {
+        return chain::_append(service::_poll(descriptor, events, flags));
+    }
+
+    /// @brief Append a transfer from one descriptor to another through the
+    ///        kernel.
+    auto splice(std::int32_t in, std::int64_t inoffset, std::int32_t out, std::int64_t outoffset,
+                std::uint32_t size, std::uint32_t spflags = 0, std::uint8_t flags = 0) -> chain & {
+        return chain::_append(service::_splice(in, inoffset, out, outoffset, size, spflags, flags));
+    }
+
+    /// @brief Start the next operation even if the last appended one fails.
+    auto hard() -> chain & {
+        assert(not m_links.empty());
+        m_links.back().entry.flags |= rcs::io::uring::SQE_IO_HARDLINK;
+        return *this;
+    }
+
+    /// @brief Get the number of operations.
+    [[nodiscard]] auto size() const -> std::uint32_t {
+        return static_cast<std::uint32_t>(m_links.size());
+    }
+
+  public:
+    auto await_ready() const -> bool { return m_links.empty(); }
+
+    auto await_resume() const -> std::vector<std::int32_t> {
+        std::vector<std::int32_t> results;
+        results.reserve(m_steps.size());
+        for (const step_t &step : m_steps) results.push_back(step.result);
+        return results;
+    }
+
+    auto await_suspend(std::coroutine_handle<> caller) -> bool {
+        // Linked entries are staged at once, which a chain longer than the
+        // submission queue can never be.
+        if (chain::size() > m_service->m_sq.r.capacity()) {
+            for (step_t &step : m_steps) step.result = -EINVAL;
+            return false;
+        }
+
+        m_continuation = caller;
+        m_remaining.store(chain::size());
+        for (step_t &step : m_steps) step.result = -1;
+
+        m_request.links = m_links;
+        m_service->m_executor.execute([this]() { m_service->_initiate(m_request); });
+        return true;
+    }
+
+  private:
+    /// @brief Append an operation described by an entry.
+    auto _append(const rcs::io::uring::sqe &entry) -> chain & {
+        step_t &step = m_steps.emplace_back(this);
+        m_links.push_back({.entry = entry, .handler = &step});
+        return *this;
+    }
+
+  private:
+    /// @brief I/O service.
+    service *m_service = nullptr;
+
+    /// @brief Completion handlers of the operations, whose addresses must
+    ///        stay stable as the chain grows.
+    std::deque<step_t> m_steps;
+
+    /// @brief Operation descriptions.
+    std::vector<struct service::link_t> m_links;
+
+    /// @brief Staging request.
+    struct service::request_t m_request = {};
+
+    /// @brief Number of operations yet to complete.
+    std::atomic<std::uint32_t> m_remaining = {0};
+
+    /// @brief Awaiting coroutine.
+    std::coroutine_handle<> m_continuation = nullptr;
+};
+
+template <rcs::execution::executor TExecutorType>
+class rcs::io::service<TExecutorType>::chain::step_t final
+    : public rcs::io::completion {
+  public:
+    explicit step_t(chain *owner)
+        : rcs::io::completion(&step_t::_complete), owner(owner) {}
+
+  private:
+    /// @brief Record the result and resume the awaiting coroutine once the
+    ///        last operation of the chain has completed.
+    static void _complete(rcs::io::completion *self, std::int32_t result, std::uint32_t flags) {
+        auto *step = static_cast<step_t *>(self);
+        (void)flags;
+
+        step->result = result;
+        if (step->owner->m_remaining.fetch_sub(1) == 1)
+            step->owner->m_continuation.resume();
+    }
+
+  public:
+    /// @brief Chain the operation belongs to.
+    chain *owner = nullptr;
+
+    /// @brief Operation result.
+    std::int32_t result = -1;
+};
+
+///
+/// @brief   Results of a multishot operation.
+///
+/// @details Queues the completion events of a multishot operation until they
+///          are consumed with `next()`. Closing the stream cancels the
+///          operation; the shared state is released once the kernel posts
+///          the final completion event.
+///
+template <rcs::execution::executor TExecutorType>
+class rcs::io::service<TExecutorType>::stream final {
+  public:
+    /// @brief Defines how the results of a multishot operation are treated.
+    struct policy_t {
+        ///
+        /// @brief   Tells whether an operation terminated by the kernel with
+        ///          the specified result should be re-armed.
+        ///
+        /// @details Negative results that lead to re-arming the operation
+        ///          are not queued.
+        ///
+        bool (*rearm)(std::int32_t result) = nullptr;
+
+        /// @brief Release the resources carried by a result that will never
+        ///        be consumed, if any.
+        void (*discard)(service *owner, const rcs::io::uring::sqe &entry, const rcs::io::uring::cqe &result) = nullptr;
+    };
+
+  private:
+    class state_t;
+
+  public:
+    stream(const stream &)                     = delete;
+    auto operator=(const stream &) -> stream & = delete;
+
+  public:
+    /// @brief Construct from an existing stream.
+    stream(stream &&other) noexcept = default;
+
+    /// @brief Assign from an existing stream.
+    auto operator=(stream &&other) noexcept -> stream & {
+        stream::close();
+        m_state = std::move(other.m_state);
+        return *this;
+    }
+
+    /// @brief Initiate the multishot operation described by an entry.
+    stream(service *owner, const rcs::io::uring::sqe &entry, const stream::policy_t &policy)
+        : m_state(std::make_unique<stream::state_t>(owner, entry, policy)) {
+        const std::unique_lock<std::mutex> lock(m_state->mutex);
+        m_state->arm();
+    }
+
+    /// @brief Close the stream.
+    ~stream() { stream::close(); }
+
+  public:
+    /// @brief Awaiter of the next result.
+    class next_t final {
+      public:
+        explicit next_t(stream::state_t *state)
+            : m_state(state) {}
+
+      public:
+        auto await_ready() const -> bool {
+            if (m_state == nullptr) return true;
+            const std::unique_lock<std::mutex> lock(m_state->mutex);
+            return not m_state->results.empty() or m_state->done;
+        }
+
+        auto await_suspend(std::coroutine_handle<> caller) -> bool {
+            const std::unique_lock<std::mutex> lock(m_state->mutex);
+            if (not m_state->results.empty() or m_state->done) return false;
+            m_state->consumer = caller;
+            return true;
+        }
+
+        auto await_resume() -> std::optional<rcs::io::uring::cqe> {
+            if (m_state == nullptr) return std::nullopt;
+            const std::unique_lock<std::mutex> lock(m_state->mutex);
+            if (m_state->results.empty()) return std::nullopt;
+
+            const rcs::io::uring::cqe entry = m_state->results.front();
+            m_state->results.pop_front();
+            return entry;
+        }
+
+      private:
+        /// @brief Shared state.
+        stream::state_t *m_state = nullptr;
+    };
+
+    ///
+    /// @brief   Await the next result.
+    ///
+    /// @return  Returns the next completion queue event or `std::nullopt`
+    ///          if the operation has terminated and every result has been
+    ///          consumed.
+    ///
+    auto next() -> stream::next_t { return stream::next_t{m_state.get()}; }
+
+    /// @brief Terminate the multishot operation and discard pending results.
+    void close() {
+        if (m_state == nullptr) return;
+
+        stream::state_t             *state = m_state.release();
+        std::unique_lock<std::mutex> lock(state->mutex);
+
+        state->orphaned = true;
+        state->consumer = nullptr;
+
+        for (const rcs::io::uring::cqe &result : state->results)
+            state->discard(result);
+        state->results.clear();
+
+        if (state->armed) {
+            // The state is released by the completion handler, which cannot
+            // run before the cancellation request has been staged.
+            state->owner->_cancel(reinterpret_cast<std::uint64_t>(
+                static_cast<rcs::io::completion *>(state)));
+            return;
+        }
+
+        lock.unlock();
+        delete state; // NOLINT
+    }
+
+  private:
+    /// @brief State shared with the event processing loop.
+    std::unique_ptr<stream::state_t> m_state = nullptr;
+};
+
+template <rcs::execution::executor TExecutorType>
+class rcs::io::service<TExecutorType>::stream::state_t final
+    : public rcs::io::completion {
+  public:
+    state_t(service *owner, const rcs::io::uring::sqe &entry, const stream::policy_t &policy)
+        : rcs::io::completion(&state_t::_complete),
+          owner(owner), entry(entry), policy(policy) {}
+
+  public:
+    /// @brief Initiate the operation. Must be called with the mutex held.
+    void arm() {
+        armed         = true;
+        link          = {.entry = entry, .handler = this};
+        request.links = std::span(&link, 1);
+        owner->_initiate(request);
+    }
+
+    /// @brief Release the resources carried by a result.
+    void discard(const rcs::io::uring::cqe &result) {
+        if (policy.discard != nullptr)
+            policy.discard(owner, entry, result);
+    }
+
+  private:
+    /// @brief Queue a result and resume the consumer, if any.
+    static void _complete(rcs::io::completion *self, std::int32_t result, std::uint32_t flags) {
+        auto                        *state = static_cast<state_t *>(self);
+        std::unique_lock<std::mutex> lock(state->mutex);
+
+        rcs::io::uring::cqe entry;
+        entry.result = result;
+        entry.flags  = flags;
+
+        bool queue = true;
+        if ((flags & rcs::io::uring::CQE_F_MORE) == 0) {
+            state->armed = false;
+
+            if (not state->orphaned and state->policy.rearm(result)) {
+                queue = result >= 0;
+                state->arm();
+            } else {
+                state->done = true;
+            }
+        }
+
+        if (state->orphaned) {
+            state->discard(entry);
+
+            const bool release = not state->armed;
+            lock.unlock();
+            if (release) delete state; // NOLINT
+            return;
+        }
+
+        if (queue) state->results.push_back(entry);
+
+        const std::coroutine_handle<> consumer =
+            std::exchange(state->consumer, nullptr);
+        lock.unlock();
+
+        if (consumer) consumer.resume();
+    }
+
+  public:
+    /// @brief I/O service.
+    service *owner = nullptr;
+
+    /// @brief Operation description.
+    rcs::io::uring::sqe entry = {};
+
+    /// @brief Result policy.
+    stream::policy_t policy = {};
+
+    /// @brief Staged entry.
+    struct service::link_t link = {};
+
+    /// @brief Staging request.
+    struct service::request_t request = {};
+
+    /// @brief Guards the state below.
+    std::mutex mutex;
+
+    /// @brief Results not consumed yet.
+    std::deque<rcs::io::uring::cqe> results;
+
+    /// @brief Coroutine awaiting the next result.
+    std::coroutine_handle<> consumer = nullptr;
+
+    /// @brief Whether the kernel refers to the state.
+    bool armed = false;
+
+    /// @brief Whether the operation has terminated for good.
+    bool done = false;
+
+    /// @brief Whether the stream has been closed.
+    bool orphaned = false;
+};
+
 // To enable LSP on template functions
 template class rcs::io::service<rcs::execution::inline_executor>;
 
@@ -0,0 +1,197 @@
+#ifndef RCS_IO_SERVICE_POOL_HPP
+#define RCS_IO_SERVICE_POOL_HPP
+
+#include <rcs/co/awaitable.hpp>
+
+#include <rcs/execution/executor.hpp>
+#include <rcs/execution/inline_executor.hpp>
+
+#include <rcs/io/options.hpp>
+#include <rcs/io/service.hpp>
+
+#include <rcs/system/affinity.hpp>
+
+#include <concepts>
+#include <exception>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <cassert>
+#include <cstdint>
+
+namespace rcs::io {
+
+///
+/// @brief   Pool of I/O services, one per processor.
+///
+/// @details Each service is driven by a worker thread of its own, pinned to
+///          a processor, so that the services share nothing but the kernel.
+///          Work meant to be spread across the services, such as accepting
+///          connections, is started on every worker; listeners bound with
+///          SO_REUSEPORT let the kernel balance the connections across the
+///          services.
+///
+template <rcs::execution::executor TExecutorType>
+class service_pool final {
+  public:
+    /// @brief Executor type.
+    using executor_t = TExecutorType;
+
+    /// @brief Service type.
+    using service_t = rcs::io::service<TExecutorType>;
+
+  public:
+    service_pool(const service_pool &)                     = delete;
+    service_pool(service_pool &&)                          = delete;
+    auto operator=(const service_pool &) -> service_pool & = delete;
+    auto operator=(service_pool &&) -> service_pool      & = delete;
+
+  public:
+    ///
+    /// @brief   Construct a pool with a service for every processor the
+    ///          calling thread is allowed to run on.
+    ///
+    /// @throws  rcs::system::exception
+    ///
+    explicit service_pool(std::uint32_t bandwidth, const rcs::io::options &options = {});
+
+    ///
+    /// @brief   Construct a pool of the specified number of services, which
+    ///          are assigned to the available processors in turn.
+    ///
+    /// @throws  rcs::system::exception
+    ///
+    service_pool(std::uint32_t size, std::uint32_t bandwidth, const rcs::io::options &options = {});
+
+    /// @brief Wait for the workers to finish.
+    ~service_pool();
+
+  public:
+    /// @brief Get the number of services.
+    [[nodiscard]] auto size() const -> std::uint32_t;
+
+    /// @brief Get the service at the specified index.
+    [[nodiscard]] auto at(std::uint32_t index) -> service_t &;
+
+    /// @brief Get the processor the service at the specified index is
+    ///        pinned to.
+    [[nodiscard]] auto cpu(std::uint32_t index) const -> std::int32_t;
+
+  public:
+    ///
+    /// @brief   Start a worker per service.
+    ///
+    /// @details Every worker pins itself to its processor, invokes
+    ///          `work(service, index)` and runs the event processing loop of
+    ///          its service until there are no pending operations left.
+    ///          The work must return an rcs::co::awaitable<void>; it is
+    ///          copied into every worker.
+    ///
+    template <typename TWork>
+        requires std::invocable<TWork &, service_t &, std::uint32_t>
+    void start(TWork work);
+
+    ///
+    /// @brief   Wait for the workers to finish.
+    ///
+    /// @throws  Rethrows the first exception a worker or its work finished
+    ///          with, if any.
+    ///
+    void join();
+
+  private:
+    /// @brief Services, whose addresses must stay stable.
+    std::vector<std::unique_ptr<service_t>> m_services;
+
+    /// @brief Processor of every service.
+    std::vector<std::int32_t> m_cpus;
+
+    /// @brief Worker threads.
+    std::vector<std::thread> m_workers;
+
+    /// @brief Exception of every worker, if any.
+    std::vector<std::exception_ptr> m_exceptions;
+};
+
+} // namespace rcs::io
+
+template <rcs::execution::executor TExecutorType>
+rcs::io::service_pool<TExecutorType>::service_pool(std::uint32_t bandwidth, const rcs::io::options &options)
+    : service_pool(static_cast<std::uint32_t>(rcs::system::cpus().size()), bandwidth, options) {}
+
+template <rcs::execution::executor TExecutorType>
+rcs::io::service_pool<TExecutorType>::service_pool(
+    std::uint32_t size, std::uint32_t bandwidth, const rcs::io::options &options) {
+    assert(size != 0);
+
+    const std::vector<std::int32_t> cpus = rcs::system::cpus();
+
+    m_services.reserve(size);
+    m_cpus.reserve(size);
+    for (std::uint32_t index = 0; index < size; ++index) {
+        m_services.push_back(std::make_unique<service_t>(executor_t{}, bandwidth, options));
+        m_cpus.push_back(cpus[index % cpus.size()]);
+    }
+}
+
+template <rcs::execution::executor TExecutorType>
+rcs::io::service_pool<TExecutorType>::~service_pool() {
+    for (std::thread &worker : m_workers)
+        if (worker.joinable()) worker.join();
+}
+
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service_pool<TExecutorType>::size()
+    const -> std::uint32_t { return static_cast<std::uint32_t>(m_services.size()); }
+
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service_pool<TExecutorType>::at(std::uint32_t index)
+    -> service_t & { return *m_services.at(index); }
+
+template <rcs::execution::executor TExecutorType>
+auto rcs::io::service_pool<TExecutorType>::cpu(std::uint32_t index)
+    const -> std::int32_t { return m_cpus.at(index); }
+
+template <rcs::execution::executor TExecutorType>
+template <typename TWork>
+    requires std::invocable<TWork &, typename rcs::io::service_pool<TExecutorType>::service_t &, std::uint32_t>
+void rcs::io::service_pool<TExecutorType>::start(TWork work) {
+    assert(m_workers.empty());
+
+    m_exceptions.assign(m_services.size(), nullptr);
+    m_workers.reserve(m_services.size());
+
+    for (std::uint32_t index = 0; index < service_pool::size(); ++index) {
+        m_workers.emplace_back([this, index, work]() mutable {
+            try {
+                rcs::system::pin(m_cpus[index]);
+
+                service_t                   &service = *m_services[index];
+                const rcs::co::awaitable<void> task  = work(service, index);
+
+                service.run();
+                task.rethrow_exception();
+            } catch (...) {
+                m_exceptions[index] = std::current_exception();
+            }
+        });
+    }
+}
+
+template <rcs::execution::executor TExecutorType>
+void rcs::io::service_pool<TExecutorType>::join() {
+    for (std::thread &worker : m_workers)
+        if (worker.joinable()) worker.join();
+    m_workers.clear();
+
+    const std::vector<std::exception_ptr> exceptions = std::exchange(m_exceptions, {});
+    for (const std::exception_ptr &exception : exceptions)
+        if (exception != nullptr) std::rethrow_exception(exception);
+}
+
+// To enable LSP on template functions
+template class rcs::io::service_pool<rcs::execution::inline_executor>;
+
+#endif
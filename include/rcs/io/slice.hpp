@@ -0,0 +1,70 @@
+#ifndef RCS_IO_SLICE_HPP
+#define RCS_IO_SLICE_HPP
+
+#include <span>
+
+#include <cstdint>
+
+namespace rcs::io {
+
+class buffer_arena;
+
+///
+/// @brief   Buffer taken from a registered buffer arena.
+///
+/// @details Remembers the index of its buffer, which fixed operations pass
+///          to the kernel along with the memory. The buffer is given back to
+///          its arena once the slice is released or destroyed.
+///
+class slice final {
+  public:
+    slice(const slice &)                     = delete;
+    auto operator=(const slice &) -> slice & = delete;
+
+  public:
+    /// @brief Construct from an existing slice.
+    slice(slice &&other) noexcept;
+
+    /// @brief Release the current buffer and take over another slice.
+    auto operator=(slice &&other) noexcept -> slice &;
+
+    /// @brief Take a buffer of an arena.
+    slice(rcs::io::buffer_arena *arena, std::uint16_t index);
+
+    /// @brief Construct an empty slice.
+    slice() = default;
+
+    /// @brief Release the buffer.
+    ~slice();
+
+  public:
+    /// @brief Check whether the slice refers to no buffer.
+    [[nodiscard]] auto empty() const -> bool;
+
+    /// @brief Get the buffer memory.
+    [[nodiscard]] auto data() const -> std::uint8_t *;
+
+    /// @brief Get the buffer size.
+    [[nodiscard]] auto size() const -> std::uint32_t;
+
+    /// @brief Get the buffer index within its arena.
+    [[nodiscard]] auto index() const -> std::uint16_t;
+
+    /// @brief Get a view of the buffer memory.
+    [[nodiscard]] auto bytes() const -> std::span<std::uint8_t>;
+
+  public:
+    /// @brief Give the buffer back to its arena.
+    void release();
+
+  private:
+    /// @brief Buffer arena the buffer belongs to.
+    rcs::io::buffer_arena *m_arena = nullptr;
+
+    /// @brief Buffer index.
+    std::uint16_t m_index = 0;
+};
+
+} // namespace rcs::io
+
+#endif
@@ -0,0 +1,59 @@
+#ifndef RCS_IO_SLOT_HPP
+#define RCS_IO_SLOT_HPP
+
+#include <cstdint>
+
+namespace rcs::io {
+
+class file_table;
+
+///
+/// @brief   Slot of a registered file table.
+///
+/// @details Container object managing the registration of a descriptor,
+///          analogous to rcs::system::handle. The slot is cleared once the
+///          container is reset or destroyed.
+///
+class slot final {
+  public:
+    slot(const slot &)                     = delete;
+    auto operator=(const slot &) -> slot & = delete;
+
+  public:
+    /// @brief Construct from an existing slot.
+    slot(slot &&other) noexcept;
+
+    /// @brief Reset the current slot and take over another one.
+    auto operator=(slot &&other) noexcept -> slot &;
+
+    /// @brief Take over a populated slot of a table.
+    slot(rcs::io::file_table *table, std::uint32_t index);
+
+    /// @brief Construct an empty slot.
+    slot() = default;
+
+    /// @brief Clear the slot.
+    ~slot();
+
+  public:
+    /// @brief Check whether the container manages no slot.
+    [[nodiscard]] auto empty() const -> bool;
+
+    /// @brief Get the slot index.
+    [[nodiscard]] auto index() const -> std::uint32_t;
+
+  public:
+    /// @brief Clear the slot, if any.
+    void reset();
+
+  private:
+    /// @brief Table the slot belongs to.
+    rcs::io::file_table *m_table = nullptr;
+
+    /// @brief Slot index.
+    std::uint32_t m_index = 0;
+};
+
+} // namespace rcs::io
+
+#endif
@@ -0,0 +1,41 @@
+#ifndef RCS_IO_STATS_HPP
+#define RCS_IO_STATS_HPP
+
+#include <cstdint>
+
+namespace rcs::io {
+
+/// @brief Snapshot of the asynchronous I/O service counters.
+struct stats final {
+    ///
+    /// @brief   Number of system calls that submitted entries to the kernel.
+    ///
+    /// @details With submission queue polling, only the wakeups of the
+    ///          polling thread are counted.
+    ///
+    std::uint64_t enters = 0;
+
+    /// @brief Number of submission queue entries consumed by the kernel.
+    std::uint64_t submitted = 0;
+
+    /// @brief Number of times the completion queue head was released.
+    std::uint64_t reaps = 0;
+
+    /// @brief Number of reaped completion queue events.
+    std::uint64_t completions = 0;
+
+    /// @brief Number of operations that had to wait for admission because
+    ///        the service was at capacity.
+    std::uint64_t admissions = 0;
+
+    /// @brief Number of completion queue events that overflowed the
+    ///        completion queue.
+    std::uint64_t overflow = 0;
+
+    /// @brief Number of detached operations that failed.
+    std::uint64_t failures = 0;
+};
+
+} // namespace rcs::io
+
+#endif
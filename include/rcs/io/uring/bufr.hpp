@@ -0,0 +1,115 @@
+#ifndef RCS_IO_URING_BUFR_HPP
+#define RCS_IO_URING_BUFR_HPP
+
+#include <cstdint>
+
+namespace rcs::io::uring {
+
+///
+/// @brief   Provided buffer ring.
+///
+/// @details Owns a group of equally sized buffers along with the ring
+///          through which they are handed over to the kernel. The kernel
+///          picks a buffer from the ring whenever an operation that selects
+///          buffers from the group has data to deliver.
+///
+class bufr final {
+  public:
+    static constexpr std::uint32_t MAX_CAPACITY = 32768;
+
+  public:
+    bufr(const bufr &other)                     = delete;
+    auto operator=(const bufr &other) -> bufr & = delete;
+
+  public:
+    /// @brief Construct from an existing buffer ring.
+    bufr(bufr &&other) noexcept;
+
+    /// @brief Assign from an existing buffer ring.
+    auto operator=(bufr &&other) noexcept -> bufr &;
+
+    ///
+    /// @brief   Construct and register a buffer ring.
+    ///
+    /// @details `capacity` must be a power of two. Every buffer is handed
+    ///          over to the kernel right away.
+    ///
+    /// @throws  rcs::system::exception
+    ///
+    bufr(std::int32_t  descriptor,
+         std::uint16_t group,
+         std::uint32_t capacity,
+         std::uint32_t size);
+
+    /// @brief Default constructor.
+    bufr() = default;
+
+    /// @brief Unregister the buffer ring and free the buffers.
+    ~bufr();
+
+  public:
+    /// @brief Get the buffer group identifier.
+    [[nodiscard]] auto group() const -> std::uint16_t;
+
+    /// @brief Get the number of buffers.
+    [[nodiscard]] auto capacity() const -> std::uint32_t;
+
+    /// @brief Get the size of a single buffer.
+    [[nodiscard]] auto size() const -> std::uint32_t;
+
+    /// @brief Get the memory of the specified buffer.
+    [[nodiscard]] auto data(std::uint16_t index) const -> std::uint8_t *;
+
+  public:
+    /// @brief Hand the specified buffer over to the kernel.
+    void provide(std::uint16_t index);
+
+  private:
+    /// @brief Append a buffer to the ring without publishing it.
+    void _push(std::uint16_t index);
+
+    /// @brief Make the appended buffers visible to the kernel.
+    void _publish() const;
+
+    /// @brief Release ownership over allocated resources, if any.
+    void _release();
+
+    /// @brief Free the allocated resources, if any.
+    void _reset();
+
+  private:
+    struct map_t {
+        std::uint8_t *base = nullptr;
+        std::uint32_t size = 0;
+    };
+
+    /// @brief Info about the mapped ring entries.
+    struct bufr::map_t m_map = {};
+
+    /// @brief Info about the mapped buffers.
+    struct bufr::map_t m_data = {};
+
+  private:
+    /// @brief Shared tail.
+    std::uint16_t *m_shared = nullptr;
+
+    /// @brief Intermediate tail state.
+    std::uint16_t m_tail = 0;
+
+    /// @brief Ring mask.
+    std::uint16_t m_mask = 0;
+
+    /// @brief Buffer group identifier.
+    std::uint16_t m_group = 0;
+
+    /// @brief Size of a single buffer.
+    std::uint32_t m_size = 0;
+
+  private:
+    /// @brief io_uring instance identifier.
+    std::int32_t m_descriptor = -1;
+};
+
+} // namespace rcs::io::uring
+
+#endif
@@ -3,6 +3,7 @@
 
 #include <rcs/io/uring/cqe.hpp>    // IWYU pragma: keep
 #include <rcs/io/uring/params.hpp> // IWYU pragma: keep
+#include <rcs/io/uring/timespec.hpp>
 
 #include <cstdint>
 
@@ -46,17 +47,54 @@ class cqr final {
     /// @brief Get the completion queue capacity.
     [[nodiscard]] auto capacity() const -> std::uint32_t;
 
+    ///
+    /// @brief   Get the number of completion queue events that did not fit
+    ///          into the queue.
+    ///
+    /// @details Counts the events that were dropped, or held back by the
+    ///          kernel until the queue had room for them.
+    ///
+    [[nodiscard]] auto overflow() const -> std::uint32_t;
+
   public:
     /// @brief Wait for completion of a specified number of events.
     void wait(std::uint32_t waitnr) const;
 
+    ///
+    /// @brief   Wait for completion of a specified number of events within
+    ///          the specified time.
+    ///
+    /// @return  Returns `false` if the time ran out first.
+    ///
+    auto wait(std::uint32_t waitnr, const rcs::io::uring::timespec &timeout) const -> bool;
+
     /// @brief Retrieve the next entry in the queue.
     [[nodiscard]] auto next()
         -> const rcs::io::uring::cqe &;
 
+    ///
+    /// @brief   Retrieve at most the specified number of entries at once.
+    ///
+    /// @details Copies the retrieved entries into `entries`, which must be
+    ///          able to hold `max` elements.
+    ///
+    /// @return  Returns the number of retrieved entries.
+    ///
+    [[nodiscard]] auto next(rcs::io::uring::cqe *entries, std::uint32_t max)
+        -> std::uint32_t;
+
     /// @brief Mark all retrieved event as consumed.
     void seen() const;
 
+  public:
+    ///
+    /// @brief   Enter the kernel through a registered ring descriptor from
+    ///          now on.
+    ///
+    /// @details The index is only valid on the thread that registered it.
+    ///
+    void registered(std::int32_t index);
+
   private:
     /// @brief Release ownership over allocated resources, if any.
     void _release();
@@ -84,8 +122,9 @@ class cqr final {
 
   private:
     struct shared_t {
-        std::uint32_t *head = nullptr;
-        std::uint32_t *tail = nullptr;
+        std::uint32_t *head     = nullptr;
+        std::uint32_t *tail     = nullptr;
+        std::uint32_t *overflow = nullptr;
     };
 
     /// @brief Shared state.
@@ -103,6 +142,9 @@ class cqr final {
   private:
     /// @brief io_uring instance identifier.
     std::int32_t m_descriptor = -1;
+
+    /// @brief Additional flags to enter the kernel with.
+    std::uint32_t m_enter = 0;
 };
 
 } // namespace rcs::io::uring
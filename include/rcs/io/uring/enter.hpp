@@ -1,6 +1,8 @@
 #ifndef RCS_IO_URING_ENTER_HPP
 #define RCS_IO_URING_ENTER_HPP
 
+#include <rcs/io/uring/getevents_arg.hpp>
+
 #include <bits/types/sigset_t.h>
 #include <cstdint>
 
@@ -27,6 +29,23 @@ auto enter(std::int32_t  descriptor,
            std::uint32_t flags,
            ::sigset_t   *sig) -> std::uint32_t;
 
+///
+/// @brief   Initiate or wait for previously initiated I/O, passing an
+///          extended argument.
+///
+/// @details `flags` must include `ENTER_EXT_ARG`. A wait that times out
+///          fails with ETIME, unless entries have been consumed.
+///
+/// @return  Returns the number of I/Os successfully consumed.
+///
+/// @throws  rcs::system::exception
+///
+auto enter(std::int32_t                         descriptor,
+           std::uint32_t                        submitnr,
+           std::uint32_t                        waitnr,
+           std::uint32_t                        flags,
+           const rcs::io::uring::getevents_arg &arg) -> std::uint32_t;
+
 } // namespace rcs::io::uring
 
 #endif
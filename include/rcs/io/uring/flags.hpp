@@ -7,6 +7,15 @@
 
 namespace rcs::io::uring {
 
+/// @details Creates a kernel thread that polls the submission queue, so that
+///          entries can be submitted without a system call as long as the
+///          thread is awake.
+static constexpr std::uint32_t SETUP_SQPOLL = 1U << 1;
+
+/// @details Binds the submission queue polling thread to the CPU specified
+///          by the `sq_thread_cpu` parameter.
+static constexpr std::uint32_t SETUP_SQ_AFF = 1U << 2;
+
 /// @details Enables the application to specify the number of entries that
 ///          the completion queue can hold which must be greater than the
 ///          submission queue capacity. The specified value may be rounded
@@ -16,6 +25,24 @@ static constexpr std::uint32_t SETUP_CQSIZE = 1U << 3;
 /// @details Clamps specified queue capacities at the kernel-defined limits.
 static constexpr std::uint32_t SETUP_CLAMP = 1U << 4;
 
+/// @details Starts the ring disabled, so that it can be enabled by the task
+///          meant to submit to it.
+static constexpr std::uint32_t SETUP_R_DISABLED = 1U << 6;
+
+/// @details Has task work run cooperatively, at the next transition into
+///          the kernel, instead of interrupting the running task.
+static constexpr std::uint32_t SETUP_COOP_TASKRUN = 1U << 8;
+
+/// @details Flags pending task work in the shared submission queue flags.
+static constexpr std::uint32_t SETUP_TASKRUN_FLAG = 1U << 9;
+
+/// @details Promises that a single task submits to the ring.
+static constexpr std::uint32_t SETUP_SINGLE_ISSUER = 1U << 12;
+
+/// @details Defers task work until the submitting task waits for
+///          completions.
+static constexpr std::uint32_t SETUP_DEFER_TASKRUN = 1U << 13;
+
 /// @details Removes the indirection array. The submission queue will be
 ///          indexed directly by the submission queue tail.
 static constexpr std::uint32_t SETUP_NO_SQARRAY = 1U << 16;
@@ -23,6 +50,29 @@ static constexpr std::uint32_t SETUP_NO_SQARRAY = 1U << 16;
 /// @details Waits for completion of the specified number of events.
 static constexpr std::uint32_t ENTER_GETEVENTS = 1U << 0;
 
+/// @details Wakes up the submission queue polling thread.
+static constexpr std::uint32_t ENTER_SQ_WAKEUP = 1U << 1;
+
+/// @details Interprets the argument of the system call as an extended
+///          argument, which carries a timeout along with the signal mask.
+static constexpr std::uint32_t ENTER_EXT_ARG = 1U << 3;
+
+/// @details Interprets the descriptor passed to the system call as an index
+///          into the table of registered ring descriptors of the task.
+static constexpr std::uint32_t ENTER_REGISTERED_RING = 1U << 4;
+
+/// @details Set in the shared submission queue flags once the polling thread
+///          went to sleep and needs to be woken up to pick up new entries.
+static constexpr std::uint32_t SQ_NEED_WAKEUP = 1U << 0;
+
+/// @details Set in the shared submission queue flags while task work is
+///          pending, which is run by entering the kernel for completions.
+static constexpr std::uint32_t SQ_TASKRUN = 1U << 2;
+
+/// @details Interprets the descriptor of a submission queue entry as an
+///          index into the table of registered files.
+static constexpr std::uint32_t SQE_FIXED_FILE = 1U << 0;
+
 /// @details Prevents a submission queue entry from being processed before
 ///          previously submitted submission queue entries have completed.
 ///          New submission queue entries will not be started before the
@@ -37,6 +87,61 @@ static constexpr std::uint32_t SQE_IO_LINK = 1U << 2;
 ///          of the completion result.
 static constexpr std::uint32_t SQE_IO_HARDLINK = 1U << 3;
 
+/// @details Lets the kernel pick a buffer from a provided buffer group once
+///          the operation has data to deliver.
+static constexpr std::uint32_t SQE_BUFFER_SELECT = 1U << 5;
+
+/// @details Keeps a submission queue entry from posting a completion queue
+///          event, unless it fails.
+static constexpr std::uint32_t SQE_CQE_SKIP_SUCCESS = 1U << 6;
+
+/// @details Keeps accepting connections with a single submission queue
+///          entry, posting a completion queue event for each of them.
+static constexpr std::uint16_t ACCEPT_MULTISHOT = 1U << 0;
+
+/// @details Keeps receiving into buffers picked from a ring with a single
+///          submission queue entry, posting a completion queue event for
+///          each of them.
+static constexpr std::uint16_t RECV_MULTISHOT = 1U << 1;
+
+/// @details Synchronizes only the file data, and the metadata needed to
+///          retrieve it.
+static constexpr std::uint32_t FSYNC_DATASYNC = 1U << 0;
+
+/// @details Interprets the input descriptor of a splice as an index into the
+///          table of registered files.
+static constexpr std::uint32_t SPLICE_F_FD_IN_FIXED = 1U << 31;
+
+/// @details Indicates that the upper bits of the completion flags carry the
+///          identifier of the selected buffer.
+static constexpr std::uint32_t CQE_F_BUFFER = 1U << 0;
+
+/// @details Position of the selected buffer identifier in the completion flags.
+static constexpr std::uint32_t CQE_BUFFER_SHIFT = 16;
+
+/// @details Indicates that the submission queue entry will produce more
+///          completion queue events.
+static constexpr std::uint32_t CQE_F_MORE = 1U << 1;
+
+/// @details Marks the notification of a zero-copy send, which tells that
+///          the kernel no longer references the sent buffer.
+static constexpr std::uint32_t CQE_F_NOTIF = 1U << 3;
+
+/// @details Completion queue events are never dropped; those that do not
+///          fit into the queue are held back by the kernel.
+static constexpr std::uint32_t FEAT_NODROP = 1U << 1;
+
+/// @details Waits for completions accept an extended argument carrying a
+///          timeout.
+static constexpr std::uint32_t FEAT_EXT_ARG = 1U << 8;
+
+/// @details Successful operations can be told not to post a completion
+///          queue event.
+static constexpr std::uint32_t FEAT_CQE_SKIP = 1U << 11;
+
+/// @details Set for the opcodes of a probe the kernel supports.
+static constexpr std::uint16_t PROBE_OP_SUPPORTED = 1U << 0;
+
 } // namespace rcs::io::uring
 
 #endif
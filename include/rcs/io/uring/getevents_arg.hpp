@@ -0,0 +1,26 @@
+#ifndef RCS_IO_URING_GETEVENTS_ARG_HPP
+#define RCS_IO_URING_GETEVENTS_ARG_HPP
+
+#include <cstdint>
+
+namespace rcs::io::uring {
+
+/// @brief Extended argument of a wait for completion events.
+struct getevents_arg final {
+    /// @brief Signal mask to wait with, if any.
+    std::uint64_t sigmask = 0;
+
+    /// @brief Size of the signal mask.
+    std::uint32_t sigmask_sz = 0;
+
+    /// @brief Minimum number of microseconds to wait for the requested
+    ///        number of events before returning with fewer.
+    std::uint32_t min_wait_usec = 0;
+
+    /// @brief Timeout of the wait, if any.
+    std::uint64_t ts = 0;
+};
+
+} // namespace rcs::io::uring
+
+#endif
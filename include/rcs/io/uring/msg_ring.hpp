@@ -0,0 +1,21 @@
+#ifndef RCS_IO_URING_MSG_RING_HPP
+#define RCS_IO_URING_MSG_RING_HPP
+
+#include <cstdint>
+
+namespace rcs::io::uring {
+
+///
+/// @brief   Post a completion queue event to an io_uring instance from any
+///          thread.
+///
+/// @details The event carries the specified token and result. Requires no
+///          ring of the caller's own, and completes synchronously.
+///
+/// @throws  rcs::system::exception
+///
+void msg_ring(std::int32_t descriptor, std::uint64_t token, std::int32_t result);
+
+} // namespace rcs::io::uring
+
+#endif
@@ -12,14 +12,31 @@ enum class op : std::uint8_t {
     /// @details Do not perform any I/O.
     nop = 0,
 
-    readv   = 1,
-    writev  = 2,
-    sendmsg = 9,
-    recvmsg = 10,
-    accept  = 13,
-    connect = 16,
-    read    = 22,
-    write   = 23,
+    readv        = 1,
+    writev       = 2,
+    fsync        = 3,
+    read_fixed   = 4,
+    write_fixed  = 5,
+    poll_add     = 6,
+    sendmsg      = 9,
+    recvmsg      = 10,
+    accept       = 13,
+    async_cancel = 14,
+    link_timeout = 15,
+    connect      = 16,
+    fallocate    = 17,
+    openat       = 18,
+    close        = 19,
+    statx        = 21,
+    read         = 22,
+    write        = 23,
+    send         = 26,
+    recv         = 27,
+    splice       = 30,
+    tee          = 33,
+    msg_ring     = 40,
+    socket       = 45,
+    send_zc      = 47,
 };
 
 } // namespace rcs::io::uring
@@ -0,0 +1,49 @@
+/// @file
+
+#ifndef RCS_IO_URING_REG_HPP
+#define RCS_IO_URING_REG_HPP
+
+#include <cstdint>
+
+namespace rcs::io::uring {
+
+/// @brief Specifies the registration operation to be performed.
+enum class reg : std::uint32_t {
+    /// @details Unregister the buffers.
+    unregister_buffers = 1,
+
+    /// @details Register a table of files the operations may refer to by
+    ///          their index.
+    files = 2,
+
+    /// @details Unregister the table of files.
+    unregister_files = 3,
+
+    /// @details Replace a range of registered files.
+    files_update = 6,
+
+    /// @details Report the supported opcodes.
+    probe = 8,
+
+    /// @details Enable a ring set up disabled.
+    enable_rings = 12,
+
+    /// @details Register buffers the operations may refer to by their index.
+    buffers2 = 15,
+
+    /// @details Register ring descriptors for the calling task.
+    ring_fds = 20,
+
+    /// @details Register a ring of buffers the kernel picks from.
+    pbuf_ring = 22,
+
+    /// @details Unregister a previously registered buffer ring.
+    unregister_pbuf_ring = 23,
+
+    /// @details Post a message to a ring without a ring of one's own.
+    send_msg_ring = 31,
+};
+
+} // namespace rcs::io::uring
+
+#endif
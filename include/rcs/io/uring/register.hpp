@@ -0,0 +1,40 @@
+#ifndef RCS_IO_URING_REGISTER_HPP
+#define RCS_IO_URING_REGISTER_HPP
+
+#include <rcs/io/uring/reg.hpp>
+
+#include <cstdint>
+
+namespace rcs::io::uring {
+
+///
+/// @brief   Register or unregister resources shared with the kernel.
+///
+/// @details Performs the registration operation `opcode` on an io_uring
+///          instance. The meaning of `arg` and `nr` depends on `opcode`.
+///
+/// @return  Returns the non-negative result of the operation.
+///
+/// @throws  rcs::system::exception
+///
+auto register_(std::int32_t        descriptor,
+               rcs::io::uring::reg opcode,
+               const void         *arg,
+               std::uint32_t       nr) -> std::int32_t;
+
+///
+/// @brief   Register an io_uring instance descriptor for the calling task.
+///
+/// @details The task may then enter the kernel with the returned index and
+///          `ENTER_REGISTERED_RING`, which spares a descriptor lookup. The
+///          index is not valid on other tasks.
+///
+/// @return  Returns the index of the registered descriptor.
+///
+/// @throws  rcs::system::exception
+///
+auto register_ring(std::int32_t descriptor) -> std::int32_t;
+
+} // namespace rcs::io::uring
+
+#endif
@@ -2,12 +2,14 @@
 #define RCS_IO_URING_SQE_HPP
 
 #include <rcs/io/uring/op.hpp>
+#include <rcs/io/uring/timespec.hpp>
 
 #include <cstdint>
 
 struct iovec;
 struct msghdr;
 struct sockaddr;
+struct statx;
 
 namespace rcs::io::uring {
 
@@ -50,6 +52,9 @@ class sqe final {
 
         /// @brief Address length pointer.
         std::uint32_t *addrlen2;
+
+        /// @brief Pointer to a file status structure.
+        struct ::statx *statxbuf;
     };
 
     union {
@@ -66,6 +71,21 @@ class sqe final {
 
         /// @brief Pointer to a message structure.
         struct ::msghdr *msg;
+
+        /// @brief Token of the targeted operation.
+        std::uint64_t target;
+
+        /// @brief Pointer to a time interval.
+        rcs::io::uring::timespec *timeout;
+
+        /// @brief Pointer to a null-terminated path name.
+        const char *path;
+
+        /// @brief Length of a file range.
+        std::uint64_t length;
+
+        /// @brief Offset into the descriptor spliced from.
+        std::uint64_t splice_offset;
     };
 
     union {
@@ -76,18 +96,65 @@ class sqe final {
 
         /// @brief Number of scatter/gather buffers.
         std::uint32_t iovnr;
+
+        /// @brief File mode, or the mode of a file range allocation.
+        std::uint32_t mode;
+
+        /// @brief Mask of the requested file status fields.
+        std::uint32_t mask;
     };
 
-  private:
-    [[maybe_unused]] std::uint8_t _m_pad1[4] = {0};
+    union {
+        std::uint8_t _m_def4[4] = {0};
+
+        /// @brief Message flags.
+        std::uint32_t msg_flags;
+
+        /// @brief Timeout flags.
+        std::uint32_t timeout_flags;
+
+        /// @brief File open flags.
+        std::uint32_t open_flags;
+
+        /// @brief File status flags.
+        std::uint32_t statx_flags;
+
+        /// @brief File synchronization flags.
+        std::uint32_t fsync_flags;
+
+        /// @brief Splice flags.
+        std::uint32_t splice_flags;
+
+        /// @brief Events to poll for.
+        std::uint32_t poll_events;
+    };
 
-  public:
     /// @brief Asynchronous completion token.
     std::uint64_t token = 0;
 
+    union {
+        std::uint8_t _m_def5[2] = {0};
+
+        /// @brief Provided buffer group identifier.
+        std::uint16_t buf_group;
+
+        /// @brief Registered buffer index.
+        std::uint16_t buf_index;
+    };
+
+  private:
+    [[maybe_unused]] std::uint8_t _m_pad2[2] = {0};
+
+  public:
+    union {
+        std::uint8_t _m_def6[4] = {0};
+
+        /// @brief Descriptor spliced from.
+        std::int32_t splice_in;
+    };
+
   private:
-    [[maybe_unused]] std::uint8_t _m_pad2[2]  = {0};
-    [[maybe_unused]] std::uint8_t _m_pad3[22] = {0};
+    [[maybe_unused]] std::uint8_t _m_pad3[16] = {0};
 };
 
 } // namespace rcs::io::uring
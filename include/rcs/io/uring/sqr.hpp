@@ -43,15 +43,53 @@ class sqr final {
     /// @brief Get the number of pending entries.
     [[nodiscard]] auto pending() const -> std::uint32_t;
 
+    /// @brief Get the number of entries not yet visible to the kernel.
+    [[nodiscard]] auto staged() const -> std::uint32_t;
+
     /// @brief Get the submission queue capacity.
     [[nodiscard]] auto capacity() const -> std::uint32_t;
 
     /// @brief Get the next entry in the submission queue.
     [[nodiscard]] auto next() -> rcs::io::uring::sqe &;
 
+    /// @brief Check whether the queue is polled by a kernel thread.
+    [[nodiscard]] auto polled() const -> bool;
+
+    /// @brief Check whether the polling thread needs to be woken up.
+    [[nodiscard]] auto wakeup() const -> bool;
+
+    /// @brief Get the number of times the polling thread was woken up.
+    [[nodiscard]] auto wakeups() const -> std::uint64_t;
+
+    /// @brief Check whether task work is pending, which posts completions
+    ///        once the kernel is entered for them.
+    [[nodiscard]] auto taskrun() const -> bool;
+
   public:
+    ///
     /// @brief   Submit the next submission entries to the kernel.
-    auto submit() const -> std::uint32_t;
+    ///
+    /// @details If the queue is polled by a kernel thread, only publishes the
+    ///          tail and enters the kernel only if the thread went to sleep.
+    ///
+    auto submit() -> std::uint32_t;
+
+    ///
+    /// @brief   Make the staged entries visible to the kernel without
+    ///          submitting them.
+    ///
+    /// @return  Returns the number of entries awaiting submission.
+    ///
+    auto flush() const -> std::uint32_t;
+
+  public:
+    ///
+    /// @brief   Enter the kernel through a registered ring descriptor from
+    ///          now on.
+    ///
+    /// @details The index is only valid on the thread that registered it.
+    ///
+    void registered(std::int32_t index);
 
   private:
     /// @brief Release ownership over allocated resources, if any.
@@ -81,7 +119,8 @@ class sqr final {
   private:
     struct shared_t {
         std::uint32_t *head = nullptr;
-        std::uint32_t *tail = nullptr;
+        std::uint32_t *tail  = nullptr;
+        std::uint32_t *flags = nullptr;
     };
 
     /// @brief Shared state.
@@ -93,12 +132,18 @@ class sqr final {
     /// @brief Ring mask.
     std::uint32_t m_mask = 0;
 
-    /// @brief Ring flags.
+    /// @brief Ring setup flags.
     std::uint32_t m_flags = 0;
 
+    /// @brief Number of times the polling thread was woken up.
+    std::uint64_t m_wakeups = 0;
+
   private:
     /// @brief io_uring instance identifier.
     std::int32_t m_descriptor = -1;
+
+    /// @brief Additional flags to enter the kernel with.
+    std::uint32_t m_enter = 0;
 };
 
 } // namespace rcs::io::uring
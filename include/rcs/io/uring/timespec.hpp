@@ -0,0 +1,29 @@
+#ifndef RCS_IO_URING_TIMESPEC_HPP
+#define RCS_IO_URING_TIMESPEC_HPP
+
+#include <chrono>
+
+#include <cstdint>
+
+namespace rcs::io::uring {
+
+/// @brief Time interval as understood by timeout operations.
+struct timespec final {
+    /// @brief Construct from a duration.
+    static auto from(std::chrono::nanoseconds duration) -> timespec {
+        const auto seconds = std::chrono::duration_cast<std::chrono::seconds>(duration);
+        return timespec{
+            .sec  = seconds.count(),
+            .nsec = (duration - seconds).count()};
+    }
+
+    /// @brief Seconds.
+    std::int64_t sec = 0;
+
+    /// @brief Nanoseconds.
+    std::int64_t nsec = 0;
+};
+
+} // namespace rcs::io::uring
+
+#endif
@@ -0,0 +1,68 @@
+#ifndef RCS_IP_RELAY_HPP
+#define RCS_IP_RELAY_HPP
+
+#include <rcs/co/awaitable.hpp>
+#include <rcs/execution/executor.hpp>
+#include <rcs/ip/socket.hpp>
+
+#include <exception>
+
+#include <cstdint>
+
+namespace rcs::ip {
+
+/// @brief Number of bytes relayed in each direction.
+struct traffic final {
+    /// @brief Bytes received on the first socket and sent on the second.
+    std::uint64_t forward = 0;
+
+    /// @brief Bytes received on the second socket and sent on the first.
+    std::uint64_t backward = 0;
+};
+
+///
+/// @brief   Relay data between two connected sockets in both directions
+///          until both remote endpoints stop sending.
+///
+/// @details Each direction is forwarded by rcs::ip::socket::forward() with
+///          a pipe of its own, so that data moves from socket to socket
+///          through the kernel. A remote endpoint that stops sending has
+///          its half-close forwarded, while the opposite direction keeps
+///          going. If either direction fails, both connections are shut
+///          down and the first error is rethrown once both directions are
+///          done.
+///
+/// @return  Returns the number of bytes relayed in each direction.
+///
+/// @throws  rcs::system::exception
+///
+template <typename TCommunicationProtocol, rcs::execution::executor TExecutorType>
+auto relay(rcs::ip::socket<TCommunicationProtocol, TExecutorType> &a,
+           rcs::ip::socket<TCommunicationProtocol, TExecutorType> &b)
+    -> rcs::co::awaitable<rcs::ip::traffic> {
+    // Both directions start right away and run concurrently.
+    rcs::co::awaitable<std::uint64_t> forward  = a.forward(b);
+    rcs::co::awaitable<std::uint64_t> backward = b.forward(a);
+
+    rcs::ip::traffic   traffic;
+    std::exception_ptr error;
+
+    try {
+        traffic.forward = co_await forward;
+    } catch (...) {
+        error = std::current_exception();
+    }
+
+    try {
+        traffic.backward = co_await backward;
+    } catch (...) {
+        if (not error) error = std::current_exception();
+    }
+
+    if (error) std::rethrow_exception(error);
+    co_return traffic;
+}
+
+} // namespace rcs::ip
+
+#endif
@@ -2,12 +2,14 @@
 #define RCS_IP_SOCKET_HPP
 
 #include <rcs/co/awaitable.hpp>
+#include <rcs/co/generator.hpp>
 
 #include <rcs/execution/executor.hpp>
 #include <rcs/execution/inline_executor.hpp>
 
 #include <rcs/system/exception.hpp>
 #include <rcs/system/handle.hpp>
+#include <rcs/system/timeout.hpp>
 
 #include <rcs/ip/address.hpp>
 #include <rcs/ip/endpoint.hpp>
@@ -16,12 +18,28 @@
 #include <rcs/ip/v4.hpp>
 #include <rcs/ip/v6.hpp>
 
+#include <rcs/io/buffer_ring.hpp>
+#include <rcs/io/file.hpp>
+#include <rcs/io/lease.hpp>
+#include <rcs/io/pipe.hpp>
+#include <rcs/io/slot.hpp>
 #include <rcs/io/service.hpp>
+#include <rcs/io/uring/flags.hpp>
 
+#include <fcntl.h>
+#include <poll.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
 
+#include <algorithm>
+#include <chrono>
 #include <exception>
+#include <span>
+#include <utility>
+#include <vector>
 
+#include <cassert>
 #include <cerrno>
 #include <cstdint>
 
@@ -100,9 +118,30 @@ class socket final {
     /// @brief Close the socket.
     void close() {
         if (-1 == m_handle.descriptor()) return;
+        m_slot.reset();
         m_handle.reset();
     }
 
+  public:
+    ///
+    /// @brief   Register the socket in the file table of the service.
+    ///
+    /// @details Subsequent operations refer to the socket by its slot index,
+    ///          which spares the kernel a descriptor lookup per operation.
+    ///          The slot is released once the socket is closed.
+    ///
+    /// @throws  rcs::system::exception
+    ///
+    void register_file() {
+        assert(m_service->files() != nullptr);
+        if (not m_slot.empty()) return;
+        m_slot = m_service->files()->acquire(m_handle.descriptor());
+    }
+
+    /// @brief Check whether the socket is registered in the file table.
+    auto fixed() const
+        -> bool { return not m_slot.empty(); }
+
   public:
     /// @brief Bind the socket to an IP endpoint.
     void bind(const socket::endpoint_t &endpoint) {
@@ -114,6 +153,21 @@ class socket final {
         m_endpoint = endpoint;
     }
 
+    ///
+    /// @brief   Allow other sockets to bind to the same endpoint, in which
+    ///          case the kernel balances incoming connections across them.
+    ///
+    /// @details Must be enabled on every such socket before binding it.
+    ///
+    void reuse_port() {
+        const std::int32_t enable = 1;
+
+        std::int32_t rv;
+        rv = ::setsockopt(m_handle.descriptor(), SOL_SOCKET, SO_REUSEPORT,
+                          &enable, sizeof(enable));
+        if (-1 == rv) throw rcs::system::exception(errno);
+    }
+
     /// @brief Listen for incoming connections.
     void listen(int bandwidth) {
         std::int32_t rv;
@@ -121,6 +175,18 @@ class socket final {
         if (-1 == rv) throw rcs::system::exception(errno);
     }
 
+    ///
+    /// @brief   Shut down the connection for receiving (SHUT_RD), sending
+    ///          (SHUT_WR) or both (SHUT_RDWR).
+    ///
+    /// @throws  rcs::system::exception
+    ///
+    void shutdown(int how) {
+        std::int32_t rv;
+        rv = ::shutdown(m_handle.descriptor(), how);
+        if (-1 == rv) throw rcs::system::exception(errno);
+    }
+
   public:
     /// @brief Accept a connection on a socket.
     auto accept() -> rcs::co::awaitable<socket> {
@@ -128,9 +194,10 @@ class socket final {
         socket       connection(*m_service);
 
         rv = co_await m_service->accept(
-            m_handle.descriptor(),
+            socket::_target(),
             connection.m_endpoint.data(),
-            connection.m_endpoint.size());
+            connection.m_endpoint.size(),
+            socket::_flags());
 
         if (rv < 0) throw rcs::system::exception(-rv);
         connection.m_handle = rv;
@@ -138,31 +205,180 @@ class socket final {
         co_return connection;
     }
 
+    ///
+    /// @brief   Accept a connection on a socket within the specified time.
+    ///
+    /// @throws  rcs::system::timeout
+    /// @throws  rcs::system::exception
+    ///
+    auto accept(std::chrono::nanoseconds timeout) -> rcs::co::awaitable<socket> {
+        std::int32_t rv;
+        socket       connection(*m_service);
+
+        rv = co_await m_service->accept_for(
+            socket::_target(),
+            connection.m_endpoint.data(),
+            connection.m_endpoint.size(),
+            timeout,
+            socket::_flags());
+
+        socket::_check(rv);
+        connection.m_handle = rv;
+
+        co_return connection;
+    }
+
+    /// @brief Connect the socket to a remote endpoint.
+    auto connect(socket::endpoint_t endpoint)
+        -> rcs::co::awaitable<void> {
+        std::int32_t rv = co_await m_service->connect(
+            socket::_target(), endpoint.data(), endpoint.size(), socket::_flags());
+        if (rv < 0) throw rcs::system::exception(-rv);
+        m_endpoint = endpoint;
+    }
+
+    ///
+    /// @brief   Connect the socket to a remote endpoint within the specified
+    ///          time.
+    ///
+    /// @throws  rcs::system::timeout
+    /// @throws  rcs::system::exception
+    ///
+    auto connect(socket::endpoint_t endpoint, std::chrono::nanoseconds timeout)
+        -> rcs::co::awaitable<void> {
+        std::int32_t rv = co_await m_service->connect_for(
+            socket::_target(), endpoint.data(), endpoint.size(), timeout, socket::_flags());
+        socket::_check(rv);
+        m_endpoint = endpoint;
+    }
+
+    ///
+    /// @brief   Accept connections on a socket as they arrive.
+    ///
+    /// @details Keeps a single multishot accept operation armed for as long
+    ///          as the generator is alive. The endpoints of the yielded
+    ///          connections are left unspecified.
+    ///
+    auto incoming() -> rcs::co::generator<socket> {
+        auto connections = m_service->accept_multishot(socket::_target(), socket::_flags());
+
+        while (true) {
+            const auto entry = co_await connections.next();
+            if (not entry.has_value()) co_return;
+            if (entry->result < 0) throw rcs::system::exception(-entry->result);
+
+            socket connection(*m_service);
+            connection.m_handle = entry->result;
+
+            co_yield std::move(connection);
+        }
+    }
+
   public:
     /// @brief Read at most the specified number of bytes from a remote endpoint.
     auto recv(void *buf, std::uint32_t bufsize)
         -> rcs::co::awaitable<std::uint32_t> {
-        std::int32_t rv = co_await m_service->read(m_handle.descriptor(), buf, bufsize, 0);
-        if (rv < 0) throw rcs::system::exception(rv);
+        std::int32_t rv = co_await m_service->read(socket::_target(), buf, bufsize, 0, socket::_flags());
+        if (rv < 0) throw rcs::system::exception(-rv);
+        co_return rv;
+    }
+
+    ///
+    /// @brief   Read at most the specified number of bytes from a remote
+    ///          endpoint within the specified time.
+    ///
+    /// @throws  rcs::system::timeout
+    /// @throws  rcs::system::exception
+    ///
+    auto recv(void *buf, std::uint32_t bufsize, std::chrono::nanoseconds timeout)
+        -> rcs::co::awaitable<std::uint32_t> {
+        std::int32_t rv = co_await m_service->read_for(
+            socket::_target(), buf, bufsize, timeout, 0, socket::_flags());
+        socket::_check(rv);
         co_return rv;
     }
 
-    /// @brief Read the specified number of bytes from a remote endpoint.
+    ///
+    /// @brief   Read from a remote endpoint into a buffer picked from a ring
+    ///          once data arrives.
+    ///
+    /// @details The returned lease holds no data once the remote endpoint
+    ///          has closed the connection.
+    ///
+    auto recv(rcs::io::buffer_ring &ring)
+        -> rcs::co::awaitable<rcs::io::lease> {
+        rcs::io::lease lease;
+        std::int32_t   rv = co_await m_service->recv(socket::_target(), ring, lease, socket::_flags());
+        if (rv < 0) throw rcs::system::exception(-rv);
+        co_return lease;
+    }
+
+    ///
+    /// @brief   Receive data from a remote endpoint as it arrives, each chunk
+    ///          in a buffer picked from a ring.
+    ///
+    /// @details Keeps a single multishot receive armed for as long as the
+    ///          generator is alive. Running out of buffers ends that receive
+    ///          with -ENOBUFS, after which a new one is started as the next
+    ///          chunk is requested, provided that some of the chunks have
+    ///          been released by then. Otherwise the receive could never pick
+    ///          a buffer, and ENOBUFS is thrown instead. The generator
+    ///          finishes once the remote endpoint has closed the connection.
+    ///
+    /// @throws  rcs::system::exception
+    ///
+    auto chunks(rcs::io::buffer_ring &ring) -> rcs::co::generator<rcs::io::lease> {
+        while (true) {
+            auto received = m_service->recv_multishot(socket::_target(), ring, socket::_flags());
+
+            while (true) {
+                const auto entry = co_await received.next();
+                if (not entry.has_value()) co_return;
+
+                rcs::io::lease chunk;
+                if ((entry->flags & rcs::io::uring::CQE_F_BUFFER) != 0) {
+                    const auto index = static_cast<std::uint16_t>(entry->flags >> rcs::io::uring::CQE_BUFFER_SHIFT);
+                    chunk            = ring.lease(index, entry->result > 0 ? static_cast<std::uint32_t>(entry->result) : 0);
+                }
+
+                if (entry->result == -ENOBUFS) {
+                    if (ring.leased() >= ring.capacity()) throw rcs::system::exception(ENOBUFS);
+                    break;
+                }
+                if (entry->result == 0) co_return;
+                if (entry->result < 0) throw rcs::system::exception(-entry->result);
+
+                co_yield std::move(chunk);
+            }
+        }
+    }
+
+    ///
+    /// @brief   Read the specified number of bytes from a remote endpoint.
+    ///
+    /// @details The kernel keeps receiving until the buffer is full, so that
+    ///          the whole transfer takes a single operation. Fewer bytes are
+    ///          only read if the remote endpoint closes the connection.
+    ///          `bufsize` is updated with the number of bytes read, even if
+    ///          an error is thrown.
+    ///
+    /// @throws  rcs::system::exception
+    ///
     auto recvall(void *buf, std::uint32_t *bufsize)
         -> rcs::co::awaitable<void> {
-        std::int32_t  rv    = 0;
         std::uint32_t total = *bufsize;
         std::uint32_t read  = 0;
         while (read < total) {
-            try {
-                rv = co_await socket::recv(
-                    reinterpret_cast<std::uint8_t *>(buf) + read, total - read);
-                if (0 == rv) break;
-                read += rv;
-            } catch (std::exception &e) {
+            // Only goes around again on kernels that return short anyway.
+            std::int32_t rv = co_await m_service->recv(
+                socket::_target(), reinterpret_cast<std::uint8_t *>(buf) + read, total - read,
+                MSG_WAITALL, socket::_flags());
+            if (rv < 0) {
                 *bufsize = read;
-                throw e;
+                throw rcs::system::exception(-rv);
             }
+            if (0 == rv) break;
+            read += rv;
         }
 
         *bufsize = read;
@@ -171,36 +387,326 @@ class socket final {
     /// @brief Send at most the specified number of bytes to a remote endpoint.
     auto send(const void *buf, std::uint32_t bufsize)
         -> rcs::co::awaitable<std::uint32_t> {
-        std::int32_t rv = co_await m_service->write(m_handle.descriptor(), buf, bufsize, 0);
-        if (rv < 0) throw rcs::system::exception(rv);
+        std::int32_t rv = co_await m_service->write(socket::_target(), buf, bufsize, 0, socket::_flags());
+        if (rv < 0) throw rcs::system::exception(-rv);
+        co_return rv;
+    }
+
+    ///
+    /// @brief   Send at most the specified number of bytes to a remote
+    ///          endpoint within the specified time.
+    ///
+    /// @throws  rcs::system::timeout
+    /// @throws  rcs::system::exception
+    ///
+    auto send(const void *buf, std::uint32_t bufsize, std::chrono::nanoseconds timeout)
+        -> rcs::co::awaitable<std::uint32_t> {
+        std::int32_t rv = co_await m_service->write_for(
+            socket::_target(), buf, bufsize, timeout, 0, socket::_flags());
+        socket::_check(rv);
+        co_return rv;
+    }
+
+    ///
+    /// @brief   Send at most the specified number of bytes to a remote
+    ///          endpoint without copying them into the kernel.
+    ///
+    /// @details Completes once the kernel no longer references the buffer.
+    ///
+    auto send_zc(const void *buf, std::uint32_t bufsize)
+        -> rcs::co::awaitable<std::uint32_t> {
+        std::int32_t rv = co_await m_service->send_zc(socket::_target(), buf, bufsize, socket::_flags());
+        if (rv < 0) throw rcs::system::exception(-rv);
         co_return rv;
     }
 
-    /// @brief Send the specified number of bytes to a remote endpoint.
+    ///
+    /// @brief   Send the specified number of bytes to a remote endpoint,
+    ///          avoiding copies for large payloads.
+    ///
+    /// @details Remainders smaller than the zero-copy threshold of the
+    ///          service are copied, since pinning them costs more than
+    ///          copying. `bufsize` is updated with the number of bytes sent,
+    ///          even if an error is thrown.
+    ///
+    /// @throws  rcs::system::exception
+    ///
+    auto sendall_zc(const void *buf, std::uint32_t *bufsize)
+        -> rcs::co::awaitable<void> {
+        const std::uint32_t threshold = m_service->options().zerocopy_threshold;
+
+        std::uint32_t total = *bufsize;
+        std::uint32_t sent  = 0;
+        while (sent < total) {
+            const auto  *data = reinterpret_cast<const std::uint8_t *>(buf) + sent;
+            std::int32_t rv   = 0;
+            if (total - sent >= threshold)
+                rv = co_await m_service->send_zc(socket::_target(), data, total - sent, socket::_flags());
+            else
+                rv = co_await m_service->send(
+                    socket::_target(), data, total - sent, MSG_NOSIGNAL, socket::_flags());
+            if (rv < 0) {
+                *bufsize = sent;
+                throw rcs::system::exception(-rv);
+            }
+            if (0 == rv) break;
+            sent += rv;
+        }
+
+        *bufsize = sent;
+    }
+
+    ///
+    /// @brief   Send the contents of multiple buffers to a remote endpoint
+    ///          within a single operation.
+    ///
+    /// @return  Returns the total number of bytes sent, which may be less
+    ///          than the total size of the buffers.
+    ///
+    auto sendv(std::span<const std::span<const std::uint8_t>> buffers)
+        -> rcs::co::awaitable<std::uint32_t> {
+        std::vector<struct ::iovec> vectors = socket::_vectors(buffers);
+
+        struct ::msghdr message = {};
+        message.msg_iov         = vectors.data();
+        message.msg_iovlen      = vectors.size();
+
+        std::int32_t rv = co_await m_service->sendmsg(
+            socket::_target(), message, MSG_NOSIGNAL, socket::_flags());
+        if (rv < 0) throw rcs::system::exception(-rv);
+        co_return rv;
+    }
+
+    ///
+    /// @brief   Read from a remote endpoint into multiple buffers within a
+    ///          single operation.
+    ///
+    /// @details The buffers are filled in order.
+    ///
+    /// @return  Returns the total number of bytes read.
+    ///
+    auto recvv(std::span<const std::span<std::uint8_t>> buffers)
+        -> rcs::co::awaitable<std::uint32_t> {
+        std::vector<struct ::iovec> vectors = socket::_vectors(buffers);
+
+        struct ::msghdr message = {};
+        message.msg_iov         = vectors.data();
+        message.msg_iovlen      = vectors.size();
+
+        std::int32_t rv = co_await m_service->recvmsg(
+            socket::_target(), message, 0, socket::_flags());
+        if (rv < 0) throw rcs::system::exception(-rv);
+        co_return rv;
+    }
+
+    ///
+    /// @brief   Send the specified number of bytes to a remote endpoint.
+    ///
+    /// @details The kernel keeps sending until the whole buffer has been
+    ///          sent, so that the transfer takes a single operation.
+    ///          `bufsize` is updated with the number of bytes sent, even if
+    ///          an error is thrown.
+    ///
+    /// @throws  rcs::system::exception
+    ///
     auto sendall(const void *buf, std::uint32_t *bufsize)
         -> rcs::co::awaitable<void> {
-        std::int32_t  rv    = 0;
         std::uint32_t total = *bufsize;
         std::uint32_t sent  = 0;
         while (sent < total) {
-            try {
-                rv = co_await socket::send(
-                    reinterpret_cast<const std::uint8_t *>(buf) + sent, total - sent);
-                if (0 == rv) break;
-                sent += rv;
-            } catch (std::exception &e) {
+            // Only goes around again on kernels that return short anyway.
+            std::int32_t rv = co_await m_service->send(
+                socket::_target(), reinterpret_cast<const std::uint8_t *>(buf) + sent, total - sent,
+                MSG_WAITALL | MSG_NOSIGNAL, socket::_flags());
+            if (rv < 0) {
                 *bufsize = sent;
-                throw e;
+                throw rcs::system::exception(-rv);
             }
+            if (0 == rv) break;
+            sent += rv;
         }
 
         *bufsize = sent;
     }
 
+    ///
+    /// @brief   Send a range of a file to a remote endpoint without copying
+    ///          it through user space.
+    ///
+    /// @details Each piece of the range is spliced from the file into a pipe
+    ///          taken from the pool of the service, and from the pipe into
+    ///          the socket, by two linked operations submitted at once.
+    ///          Pieces are cut at page boundaries, so that each of them fits
+    ///          the pipe. Fewer bytes are only sent if the file ends first.
+    ///
+    /// @return  Returns the number of bytes sent.
+    ///
+    /// @throws  rcs::system::exception
+    ///
+    auto sendfile(const rcs::io::file<socket::executor_t> &file, std::uint64_t offset, std::uint64_t length)
+        -> rcs::co::awaitable<std::uint64_t> {
+        static const auto PAGE = static_cast<std::uint64_t>(::sysconf(_SC_PAGESIZE));
+
+        rcs::io::pipe pipe = m_service->pipes().acquire();
+
+        std::uint64_t sent = 0;
+        while (sent < length) {
+            // The pipe holds a page per slot, the first of which is only
+            // partially filled if the piece does not start at a boundary.
+            const std::uint64_t room = pipe.capacity() - ((offset + sent) % PAGE);
+            const auto          size = static_cast<std::uint32_t>(std::min(length - sent, room));
+
+            auto chain = m_service->link();
+            chain.splice(file.descriptor(), static_cast<std::int64_t>(offset + sent), pipe.out(), -1, size)
+                .splice(pipe.in(), -1, socket::_target(), -1, size, 0, socket::_flags());
+            const std::vector<std::int32_t> results = co_await chain;
+
+            // Nothing has entered the pipe if the first splice failed.
+            if (results[0] < 0) throw rcs::system::exception(-results[0]);
+            if (results[1] < 0 and results[1] != -ECANCELED) {
+                pipe.discard();
+                throw rcs::system::exception(-results[1]);
+            }
+
+            // A piece cut short by the end of the file cancels the splice out
+            // of the pipe, and a short send leaves data behind, either of
+            // which is drained on its own.
+            const std::int32_t moved   = results[0];
+            std::int32_t       drained = std::max(results[1], 0);
+            while (drained < moved) {
+                std::int32_t rv = co_await m_service->splice(
+                    pipe.in(), -1, socket::_target(), -1, moved - drained, 0, socket::_flags());
+                if (rv <= 0) {
+                    pipe.discard();
+                    throw rcs::system::exception(rv < 0 ? -rv : EPIPE);
+                }
+                drained += rv;
+            }
+
+            sent += moved;
+            if (moved == 0) break;
+        }
+
+        co_return sent;
+    }
+
+    ///
+    /// @brief   Forward whatever the remote endpoint sends to another socket,
+    ///          without copying it through user space, until the remote
+    ///          endpoint stops sending.
+    ///
+    /// @details Each chunk passes through a pipe taken from the pool of the
+    ///          service by a single submission of three linked operations: a
+    ///          poll for data, a splice into the pipe, and a splice out of
+    ///          the pipe into the other socket. Splicing from a socket always
+    ///          runs on a kernel worker, which the poll keeps from blocking
+    ///          until data arrives. The splice out is hard-linked, since the
+    ///          splice in rarely fills the pipe, and does not wait for the
+    ///          pipe, so that it fails instead once there was nothing to
+    ///          move. Whatever it leaves behind is drained on its own.
+    ///
+    ///          Once the remote endpoint stops sending, the other socket is
+    ///          shut down for sending, which forwards the half-close. On
+    ///          error, both connections are shut down, which also ends
+    ///          forwarding in the opposite direction.
+    ///
+    /// @return  Returns the number of bytes forwarded.
+    ///
+    /// @throws  rcs::system::exception
+    ///
+    auto forward(socket &to) -> rcs::co::awaitable<std::uint64_t> {
+        rcs::io::pipe pipe = m_service->pipes().acquire();
+
+        const std::uint32_t spflags = socket::fixed() ? rcs::io::uring::SPLICE_F_FD_IN_FIXED : 0;
+
+        std::uint64_t forwarded = 0;
+        while (true) {
+            auto chain = m_service->link();
+            chain.poll(socket::_target(), POLLIN, socket::_flags())
+                .splice(socket::_target(), -1, pipe.out(), -1, pipe.capacity(), spflags)
+                .hard()
+                .splice(pipe.in(), -1, to._target(), -1, pipe.capacity(), SPLICE_F_NONBLOCK, to._flags());
+            const std::vector<std::int32_t> results = co_await chain;
+
+            // Nothing has entered the pipe unless the splice in moved data,
+            // in which case the splice out may have failed only for lack of
+            // room in the other socket. Readiness may also have been consumed
+            // by someone else.
+            if (results[0] < 0) socket::_abort(to, -results[0]);
+            if (results[1] == -EAGAIN) continue;
+            if (results[1] < 0) socket::_abort(to, -results[1]);
+            if (results[2] < 0 and results[2] != -EAGAIN and results[2] != -ECANCELED) {
+                pipe.discard();
+                socket::_abort(to, -results[2]);
+            }
+
+            const std::int32_t moved = results[1];
+            if (moved == 0) break;
+
+            std::int32_t drained = std::max(results[2], 0);
+            while (drained < moved) {
+                const std::int32_t rv = co_await m_service->splice(
+                    pipe.in(), -1, to._target(), -1, moved - drained, 0, to._flags());
+                if (rv <= 0) {
+                    pipe.discard();
+                    socket::_abort(to, rv < 0 ? -rv : EPIPE);
+                }
+                drained += rv;
+            }
+
+            forwarded += static_cast<std::uint64_t>(moved);
+        }
+
+        // The other connection may already be gone, in which case there is
+        // no one left to tell.
+        (void)::shutdown(to.descriptor(), SHUT_WR);
+
+        co_return forwarded;
+    }
+
   private:
     /// @brief Default constructor.
     socket() = default;
 
+  private:
+    /// @brief Get the slot index if the socket is registered, or the
+    ///        descriptor otherwise.
+    auto _target() const -> std::int32_t {
+        return m_slot.empty() ? m_handle.descriptor()
+                              : static_cast<std::int32_t>(m_slot.index());
+    }
+
+    /// @brief Get the submission flags addressing the socket.
+    auto _flags() const -> std::uint8_t {
+        return m_slot.empty() ? 0 : rcs::io::uring::SQE_FIXED_FILE;
+    }
+
+    /// @brief Describe a sequence of buffers for a vectored operation.
+    template <typename TByteType>
+    static auto _vectors(std::span<const std::span<TByteType>> buffers)
+        -> std::vector<struct ::iovec> {
+        std::vector<struct ::iovec> vectors;
+        vectors.reserve(buffers.size());
+        for (const std::span<TByteType> &buffer : buffers)
+            vectors.push_back({
+                .iov_base = const_cast<std::uint8_t *>(buffer.data()),
+                .iov_len  = buffer.size()});
+        return vectors;
+    }
+
+    /// @brief Shut down both connections of a forwarding and throw.
+    [[noreturn]] void _abort(socket &to, std::int32_t error) {
+        (void)::shutdown(m_handle.descriptor(), SHUT_RDWR);
+        (void)::shutdown(to.descriptor(), SHUT_RDWR);
+        throw rcs::system::exception(error);
+    }
+
+    /// @brief Throw if the result of a deadline operation is an error.
+    static void _check(std::int32_t rv) {
+        if (rv == -ETIME) throw rcs::system::timeout();
+        if (rv < 0) throw rcs::system::exception(-rv);
+    }
+
   private:
     /// @brief I/O service
     socket::service_t *m_service = nullptr;
@@ -208,6 +714,10 @@ class socket final {
     /// @brief ...
     rcs::system::handle m_handle = -1;
 
+    /// @brief Registered file table slot, released before the socket is
+    ///        closed.
+    rcs::io::slot m_slot;
+
     /// @brief ...
     socket::endpoint_t m_endpoint;
 };
@@ -0,0 +1,26 @@
+#ifndef RCS_SYSTEM_AFFINITY_HPP
+#define RCS_SYSTEM_AFFINITY_HPP
+
+#include <vector>
+
+#include <cstdint>
+
+namespace rcs::system {
+
+///
+/// @brief   Get the processors the calling thread is allowed to run on.
+///
+/// @throws  rcs::system::exception
+///
+auto cpus() -> std::vector<std::int32_t>;
+
+///
+/// @brief   Restrict the calling thread to the specified processor.
+///
+/// @throws  rcs::system::exception
+///
+void pin(std::int32_t cpu);
+
+} // namespace rcs::system
+
+#endif
@@ -0,0 +1,22 @@
+#ifndef RCS_SYSTEM_TIMEOUT_HPP
+#define RCS_SYSTEM_TIMEOUT_HPP
+
+#include <exception>
+
+namespace rcs::system {
+
+/// @brief Defines a type of object to be thrown as exception. It reports
+///        operations that did not complete before their deadline.
+class timeout final : public std::exception {
+  public:
+    /// @brief Default constructor.
+    timeout() = default;
+
+    /// @brief Get an explanatory string.
+    [[nodiscard]] auto what() const noexcept
+        -> const char * override { return "operation timed out"; }
+};
+
+} // namespace rcs::system
+
+#endif
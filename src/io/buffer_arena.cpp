@@ -0,0 +1,122 @@
+#include <rcs/io/buffer_arena.hpp>
+#include <rcs/io/slice.hpp>
+
+#include <rcs/io/uring/reg.hpp>
+#include <rcs/io/uring/register.hpp>
+
+#include <rcs/system/exception.hpp>
+
+#include <sys/mman.h>
+#include <sys/uio.h>
+
+#include <mutex>
+#include <vector>
+
+#include <cassert>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+
+namespace {
+
+/// @brief Resource registration request.
+struct rsrc_register {
+    std::uint32_t nr    = 0;
+    std::uint32_t flags = 0;
+
+    [[maybe_unused]] std::uint64_t _m_resv2 = 0;
+
+    std::uint64_t data = 0;
+    std::uint64_t tags = 0;
+};
+
+} // namespace
+
+rcs::io::buffer_arena::buffer_arena(
+    std::int32_t descriptor, std::uint32_t capacity, std::uint32_t size)
+    : m_capacity(capacity), m_size(size) {
+    assert(capacity != 0 and capacity <= MAX_CAPACITY);
+    assert(size != 0);
+
+    const std::size_t total = static_cast<std::size_t>(capacity) * size;
+
+    m_base = reinterpret_cast<std::uint8_t *>(
+        ::mmap(nullptr, total,
+               PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS,
+               -1, 0));
+    if (m_base == MAP_FAILED) {
+        m_base = nullptr;
+        throw rcs::system::exception(errno);
+    }
+
+    std::vector<struct ::iovec> vectors(capacity);
+    for (std::uint32_t index = 0; index < capacity; ++index)
+        vectors[index] = {.iov_base = buffer_arena::data(static_cast<std::uint16_t>(index)),
+                          .iov_len  = size};
+
+    const rsrc_register request = {
+        .nr   = capacity,
+        .data = reinterpret_cast<std::uint64_t>(vectors.data())};
+
+    try {
+        (void)rcs::io::uring::register_(
+            descriptor, rcs::io::uring::reg::buffers2, &request, sizeof(request));
+    } catch (...) {
+        ::munmap(m_base, total);
+        throw;
+    }
+
+    m_descriptor = descriptor;
+
+    // Hand out the lowest indices first.
+    m_free.reserve(capacity);
+    for (std::uint32_t index = capacity; index > 0; --index)
+        m_free.push_back(static_cast<std::uint16_t>(index - 1));
+}
+
+rcs::io::buffer_arena::~buffer_arena() {
+    try {
+        (void)rcs::io::uring::register_(
+            m_descriptor, rcs::io::uring::reg::unregister_buffers, nullptr, 0);
+    } catch (...) { // NOLINT(bugprone-empty-catch)
+        // The buffers are unregistered anyway once the instance is closed.
+    }
+
+    ::munmap(m_base, static_cast<std::size_t>(m_capacity) * m_size);
+}
+
+auto rcs::io::buffer_arena::capacity() const
+    -> std::uint32_t { return m_capacity; }
+
+auto rcs::io::buffer_arena::size() const
+    -> std::uint32_t { return m_size; }
+
+auto rcs::io::buffer_arena::available() const
+    -> std::uint32_t {
+    const std::unique_lock<std::mutex> lock(m_mutex);
+    return static_cast<std::uint32_t>(m_free.size());
+}
+
+auto rcs::io::buffer_arena::data(std::uint16_t index) const
+    -> std::uint8_t * {
+    assert(index < m_capacity);
+    return m_base + (static_cast<std::size_t>(index) * m_size);
+}
+
+auto rcs::io::buffer_arena::acquire()
+    -> rcs::io::slice {
+    const std::unique_lock<std::mutex> lock(m_mutex);
+    if (m_free.empty()) throw rcs::system::exception(ENOBUFS);
+
+    const std::uint16_t index = m_free.back();
+    m_free.pop_back();
+
+    return rcs::io::slice(this, index);
+}
+
+void rcs::io::buffer_arena::release(std::uint16_t index) {
+    assert(index < m_capacity);
+
+    const std::unique_lock<std::mutex> lock(m_mutex);
+    m_free.push_back(index);
+}
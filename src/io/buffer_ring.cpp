@@ -0,0 +1,43 @@
+#include <rcs/io/buffer_ring.hpp>
+#include <rcs/io/lease.hpp>
+#include <rcs/io/uring/bufr.hpp>
+
+#include <mutex>
+
+#include <cstdint>
+
+rcs::io::buffer_ring::buffer_ring(
+    std::int32_t  descriptor,
+    std::uint16_t group,
+    std::uint32_t capacity,
+    std::uint32_t size)
+    : m_ring(descriptor, group, capacity, size) {}
+
+auto rcs::io::buffer_ring::group() const
+    -> std::uint16_t { return m_ring.group(); }
+
+auto rcs::io::buffer_ring::capacity() const
+    -> std::uint32_t { return m_ring.capacity(); }
+
+auto rcs::io::buffer_ring::size() const
+    -> std::uint32_t { return m_ring.size(); }
+
+auto rcs::io::buffer_ring::data(std::uint16_t index) const
+    -> std::uint8_t * { return m_ring.data(index); }
+
+auto rcs::io::buffer_ring::leased() const
+    -> std::uint32_t { return m_leased.load(); }
+
+auto rcs::io::buffer_ring::lease(std::uint16_t index, std::uint32_t size)
+    -> rcs::io::lease {
+    m_leased.fetch_add(1);
+    return rcs::io::lease(this, index, size);
+}
+
+void rcs::io::buffer_ring::release(std::uint16_t index) {
+    {
+        const std::unique_lock<std::mutex> lock(m_mutex);
+        m_ring.provide(index);
+    }
+    m_leased.fetch_sub(1);
+}
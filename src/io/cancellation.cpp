@@ -0,0 +1,37 @@
+#include <rcs/io/cancellation.hpp>
+
+#include <mutex>
+
+#include <cstdint>
+
+auto rcs::io::cancellation::requested() const
+    -> bool {
+    const std::unique_lock<std::mutex> lock(m_mutex);
+    return m_requested;
+}
+
+void rcs::io::cancellation::cancel() {
+    const std::unique_lock<std::mutex> lock(m_mutex);
+    m_requested = true;
+    if (m_function != nullptr) m_function(m_context, m_token);
+}
+
+void rcs::io::cancellation::reset() {
+    const std::unique_lock<std::mutex> lock(m_mutex);
+    m_requested = false;
+}
+
+void rcs::io::cancellation::attach(
+    cancellation::function_t function, void *context, std::uint64_t token) {
+    const std::unique_lock<std::mutex> lock(m_mutex);
+    m_function = function;
+    m_context  = context;
+    m_token    = token;
+}
+
+void rcs::io::cancellation::detach() {
+    const std::unique_lock<std::mutex> lock(m_mutex);
+    m_function = nullptr;
+    m_context  = nullptr;
+    m_token    = 0;
+}
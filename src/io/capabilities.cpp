@@ -0,0 +1,100 @@
+#include <rcs/io/capabilities.hpp>
+
+#include <rcs/io/uring/flags.hpp>
+#include <rcs/io/uring/msg_ring.hpp>
+#include <rcs/io/uring/op.hpp>
+#include <rcs/io/uring/params.hpp>
+#include <rcs/io/uring/reg.hpp>
+#include <rcs/io/uring/register.hpp>
+
+#include <rcs/system/exception.hpp>
+
+#include <algorithm>
+#include <array>
+
+#include <cerrno>
+#include <cstdint>
+
+namespace {
+
+/// @brief Support of a single opcode.
+struct probe_op {
+    std::uint8_t op = 0;
+
+    [[maybe_unused]] std::uint8_t _m_resv = 0;
+
+    std::uint16_t flags = 0;
+
+    [[maybe_unused]] std::uint32_t _m_resv2 = 0;
+};
+
+/// @brief Opcode probe request.
+struct probe {
+    std::uint8_t last_op = 0;
+    std::uint8_t ops_len = 0;
+
+    [[maybe_unused]] std::uint16_t                _m_resv  = 0;
+    [[maybe_unused]] std::array<std::uint32_t, 3> _m_resv2 = {};
+
+    std::array<probe_op, 256> ops = {};
+};
+
+} // namespace
+
+rcs::io::capabilities::capabilities(std::int32_t descriptor, const rcs::io::uring::params &params)
+    : m_features(params.features), m_setup(params.flags) {
+    try {
+        rcs::io::uring::msg_ring(-1, 0, 0);
+    } catch (const rcs::system::exception &e) {
+        m_messages = e.error_code() == EBADF;
+    }
+
+    probe request;
+
+    try {
+        (void)rcs::io::uring::register_(
+            descriptor, rcs::io::uring::reg::probe, &request, request.ops.size());
+    } catch (const rcs::system::exception &e) {
+        // Kernels that predate probing know none of the optional opcodes.
+        if (e.error_code() != EINVAL) throw;
+        return;
+    }
+
+    const std::uint32_t count = std::min<std::uint32_t>(request.ops_len, request.ops.size());
+    for (std::uint32_t index = 0; index < count; ++index)
+        if ((request.ops[index].flags & rcs::io::uring::PROBE_OP_SUPPORTED) != 0)
+            m_ops.set(request.ops[index].op);
+}
+
+auto rcs::io::capabilities::supports(rcs::io::uring::op opcode)
+    const -> bool { return m_ops.test(static_cast<std::uint8_t>(opcode)); }
+
+auto rcs::io::capabilities::features()
+    const -> std::uint32_t { return m_features; }
+
+auto rcs::io::capabilities::setup()
+    const -> std::uint32_t { return m_setup; }
+
+auto rcs::io::capabilities::timed_wait()
+    const -> bool { return (m_features & rcs::io::uring::FEAT_EXT_ARG) != 0; }
+
+auto rcs::io::capabilities::multishot()
+    const -> bool { return capabilities::supports(rcs::io::uring::op::socket); }
+
+auto rcs::io::capabilities::multishot_recv()
+    const -> bool { return capabilities::supports(rcs::io::uring::op::send_zc); }
+
+auto rcs::io::capabilities::buffer_rings()
+    const -> bool { return capabilities::supports(rcs::io::uring::op::socket); }
+
+auto rcs::io::capabilities::skip_success()
+    const -> bool { return (m_features & rcs::io::uring::FEAT_CQE_SKIP) != 0; }
+
+auto rcs::io::capabilities::zerocopy()
+    const -> bool { return capabilities::supports(rcs::io::uring::op::send_zc); }
+
+auto rcs::io::capabilities::no_sqarray()
+    const -> bool { return (m_setup & rcs::io::uring::SETUP_NO_SQARRAY) != 0; }
+
+auto rcs::io::capabilities::direct_messages()
+    const -> bool { return m_messages; }
@@ -0,0 +1,101 @@
+#include <rcs/io/file_table.hpp>
+#include <rcs/io/slot.hpp>
+
+#include <rcs/io/uring/reg.hpp>
+#include <rcs/io/uring/register.hpp>
+
+#include <rcs/system/exception.hpp>
+
+#include <mutex>
+#include <vector>
+
+#include <cassert>
+#include <cerrno>
+#include <cstdint>
+
+namespace {
+
+/// @brief Registered files update request.
+struct files_update {
+    std::uint32_t offset = 0;
+
+    [[maybe_unused]] std::uint32_t _m_resv = 0;
+
+    std::uint64_t descriptors = 0;
+};
+
+} // namespace
+
+rcs::io::file_table::file_table(std::int32_t descriptor, std::uint32_t capacity)
+    : m_descriptor(descriptor), m_capacity(capacity) {
+    // Unused slots are marked with -1.
+    const std::vector<std::int32_t> descriptors(capacity, -1);
+    (void)rcs::io::uring::register_(
+        m_descriptor, rcs::io::uring::reg::files, descriptors.data(), capacity);
+
+    // Hand out the lowest indices first.
+    m_free.reserve(capacity);
+    for (std::uint32_t index = capacity; index > 0; --index)
+        m_free.push_back(index - 1);
+}
+
+rcs::io::file_table::~file_table() {
+    try {
+        (void)rcs::io::uring::register_(
+            m_descriptor, rcs::io::uring::reg::unregister_files, nullptr, 0);
+    } catch (...) { // NOLINT(bugprone-empty-catch)
+        // The table is unregistered anyway once the instance is closed.
+    }
+}
+
+auto rcs::io::file_table::capacity() const
+    -> std::uint32_t { return m_capacity; }
+
+auto rcs::io::file_table::available() const
+    -> std::uint32_t {
+    const std::unique_lock<std::mutex> lock(m_mutex);
+    return static_cast<std::uint32_t>(m_free.size());
+}
+
+auto rcs::io::file_table::acquire(std::int32_t descriptor)
+    -> rcs::io::slot {
+    std::uint32_t index = 0;
+    {
+        const std::unique_lock<std::mutex> lock(m_mutex);
+        if (m_free.empty()) throw rcs::system::exception(ENFILE);
+        index = m_free.back();
+        m_free.pop_back();
+    }
+
+    try {
+        file_table::_update(index, descriptor);
+    } catch (...) {
+        const std::unique_lock<std::mutex> lock(m_mutex);
+        m_free.push_back(index);
+        throw;
+    }
+
+    return rcs::io::slot(this, index);
+}
+
+void rcs::io::file_table::release(std::uint32_t index) {
+    assert(index < m_capacity);
+
+    try {
+        file_table::_update(index, -1);
+    } catch (...) { // NOLINT(bugprone-empty-catch)
+        // A slot that could not be cleared is overwritten once reused.
+    }
+
+    const std::unique_lock<std::mutex> lock(m_mutex);
+    m_free.push_back(index);
+}
+
+void rcs::io::file_table::_update(std::uint32_t index, std::int32_t descriptor) const {
+    const files_update request = {
+        .offset      = index,
+        .descriptors = reinterpret_cast<std::uint64_t>(&descriptor)};
+
+    (void)rcs::io::uring::register_(
+        m_descriptor, rcs::io::uring::reg::files_update, &request, 1);
+}
@@ -0,0 +1,48 @@
+#include <rcs/io/buffer_ring.hpp>
+#include <rcs/io/lease.hpp>
+
+#include <utility>
+
+#include <cstdint>
+
+rcs::io::lease::lease(lease &&other) noexcept
+    : m_ring(std::exchange(other.m_ring, nullptr)),
+      m_index(other.m_index),
+      m_size(other.m_size) {}
+
+auto rcs::io::lease::operator=(lease &&other) noexcept
+    -> lease & {
+    lease::release();
+
+    m_ring  = std::exchange(other.m_ring, nullptr);
+    m_index = other.m_index;
+    m_size  = other.m_size;
+
+    return *this;
+}
+
+rcs::io::lease::lease(rcs::io::buffer_ring *ring, std::uint16_t index, std::uint32_t size)
+    : m_ring(ring), m_index(index), m_size(size) {}
+
+auto rcs::io::lease::empty() const
+    -> bool { return m_ring == nullptr; }
+
+auto rcs::io::lease::data() const
+    -> std::uint8_t * { return m_ring != nullptr ? m_ring->data(m_index) : nullptr; }
+
+auto rcs::io::lease::size() const
+    -> std::uint32_t { return m_ring != nullptr ? m_size : 0; }
+
+auto rcs::io::lease::index() const
+    -> std::uint16_t { return m_index; }
+
+void rcs::io::lease::release() {
+    if (m_ring == nullptr) return;
+    m_ring->release(m_index);
+    m_ring = nullptr;
+    m_size = 0;
+}
+
+rcs::io::lease::~lease() {
+    lease::release();
+}
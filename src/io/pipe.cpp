@@ -0,0 +1,62 @@
+#include <rcs/io/pipe.hpp>
+#include <rcs/io/pipe_pool.hpp>
+
+#include <unistd.h>
+
+#include <utility>
+
+#include <cstdint>
+
+rcs::io::pipe::pipe(pipe &&other) noexcept
+    : m_pool(std::exchange(other.m_pool, nullptr)),
+      m_in(std::exchange(other.m_in, -1)),
+      m_out(std::exchange(other.m_out, -1)),
+      m_capacity(std::exchange(other.m_capacity, 0)) {}
+
+auto rcs::io::pipe::operator=(pipe &&other) noexcept
+    -> pipe & {
+    pipe::release();
+
+    m_pool     = std::exchange(other.m_pool, nullptr);
+    m_in       = std::exchange(other.m_in, -1);
+    m_out      = std::exchange(other.m_out, -1);
+    m_capacity = std::exchange(other.m_capacity, 0);
+
+    return *this;
+}
+
+rcs::io::pipe::pipe(rcs::io::pipe_pool *pool, std::int32_t in, std::int32_t out, std::uint32_t capacity)
+    : m_pool(pool), m_in(in), m_out(out), m_capacity(capacity) {}
+
+auto rcs::io::pipe::empty() const
+    -> bool { return m_in == -1; }
+
+auto rcs::io::pipe::in() const
+    -> std::int32_t { return m_in; }
+
+auto rcs::io::pipe::out() const
+    -> std::int32_t { return m_out; }
+
+auto rcs::io::pipe::capacity() const
+    -> std::uint32_t { return m_capacity; }
+
+void rcs::io::pipe::release() {
+    if (m_in == -1) return;
+    if (m_pool != nullptr)
+        m_pool->release(m_in, m_out, m_capacity);
+    else
+        ::close(m_in), ::close(m_out);
+
+    m_pool = nullptr;
+    m_in = m_out = -1;
+    m_capacity   = 0;
+}
+
+void rcs::io::pipe::discard() {
+    m_pool = nullptr;
+    pipe::release();
+}
+
+rcs::io::pipe::~pipe() {
+    pipe::release();
+}
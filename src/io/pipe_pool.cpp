@@ -0,0 +1,69 @@
+#include <rcs/io/pipe.hpp>
+#include <rcs/io/pipe_pool.hpp>
+
+#include <rcs/system/exception.hpp>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <array>
+#include <mutex>
+#include <vector>
+
+#include <cerrno>
+#include <cstdint>
+
+rcs::io::pipe_pool::pipe_pool(std::uint32_t capacity, std::uint32_t idle)
+    : m_capacity(capacity), m_limit(idle) {
+    m_idle.reserve(idle);
+}
+
+rcs::io::pipe_pool::~pipe_pool() {
+    for (const struct entry_t &entry : m_idle) ::close(entry.in), ::close(entry.out);
+}
+
+auto rcs::io::pipe_pool::idle() const
+    -> std::uint32_t {
+    const std::unique_lock<std::mutex> lock(m_mutex);
+    return static_cast<std::uint32_t>(m_idle.size());
+}
+
+auto rcs::io::pipe_pool::acquire()
+    -> rcs::io::pipe {
+    {
+        const std::unique_lock<std::mutex> lock(m_mutex);
+        if (not m_idle.empty()) {
+            const struct entry_t entry = m_idle.back();
+            m_idle.pop_back();
+            return rcs::io::pipe(this, entry.in, entry.out, entry.capacity);
+        }
+    }
+
+    std::array<std::int32_t, 2> descriptors = {-1, -1};
+    if (::pipe2(descriptors.data(), O_CLOEXEC) == -1) throw rcs::system::exception(errno);
+
+    // Unprivileged processes cannot grow pipes beyond the system limit, in
+    // which case the pipe keeps its default size.
+    (void)::fcntl(descriptors[1], F_SETPIPE_SZ, static_cast<int>(m_capacity));
+
+    const std::int32_t capacity = ::fcntl(descriptors[1], F_GETPIPE_SZ);
+    if (capacity == -1) {
+        const std::int32_t error = errno;
+        ::close(descriptors[0]), ::close(descriptors[1]);
+        throw rcs::system::exception(error);
+    }
+
+    return rcs::io::pipe(this, descriptors[0], descriptors[1], static_cast<std::uint32_t>(capacity));
+}
+
+void rcs::io::pipe_pool::release(std::int32_t in, std::int32_t out, std::uint32_t capacity) {
+    {
+        const std::unique_lock<std::mutex> lock(m_mutex);
+        if (m_idle.size() < m_limit) {
+            m_idle.push_back({.in = in, .out = out, .capacity = capacity});
+            return;
+        }
+    }
+
+    ::close(in), ::close(out);
+}
@@ -0,0 +1,49 @@
+#include <rcs/io/buffer_arena.hpp>
+#include <rcs/io/slice.hpp>
+
+#include <span>
+#include <utility>
+
+#include <cstdint>
+
+rcs::io::slice::slice(slice &&other) noexcept
+    : m_arena(std::exchange(other.m_arena, nullptr)),
+      m_index(other.m_index) {}
+
+auto rcs::io::slice::operator=(slice &&other) noexcept
+    -> slice & {
+    slice::release();
+
+    m_arena = std::exchange(other.m_arena, nullptr);
+    m_index = other.m_index;
+
+    return *this;
+}
+
+rcs::io::slice::slice(rcs::io::buffer_arena *arena, std::uint16_t index)
+    : m_arena(arena), m_index(index) {}
+
+auto rcs::io::slice::empty() const
+    -> bool { return m_arena == nullptr; }
+
+auto rcs::io::slice::data() const
+    -> std::uint8_t * { return m_arena != nullptr ? m_arena->data(m_index) : nullptr; }
+
+auto rcs::io::slice::size() const
+    -> std::uint32_t { return m_arena != nullptr ? m_arena->size() : 0; }
+
+auto rcs::io::slice::index() const
+    -> std::uint16_t { return m_index; }
+
+auto rcs::io::slice::bytes() const
+    -> std::span<std::uint8_t> { return {slice::data(), slice::size()}; }
+
+void rcs::io::slice::release() {
+    if (m_arena == nullptr) return;
+    m_arena->release(m_index);
+    m_arena = nullptr;
+}
+
+rcs::io::slice::~slice() {
+    slice::release();
+}
@@ -0,0 +1,39 @@
+#include <rcs/io/file_table.hpp>
+#include <rcs/io/slot.hpp>
+
+#include <utility>
+
+#include <cstdint>
+
+rcs::io::slot::slot(slot &&other) noexcept
+    : m_table(std::exchange(other.m_table, nullptr)),
+      m_index(other.m_index) {}
+
+auto rcs::io::slot::operator=(slot &&other) noexcept
+    -> slot & {
+    slot::reset();
+
+    m_table = std::exchange(other.m_table, nullptr);
+    m_index = other.m_index;
+
+    return *this;
+}
+
+rcs::io::slot::slot(rcs::io::file_table *table, std::uint32_t index)
+    : m_table(table), m_index(index) {}
+
+auto rcs::io::slot::empty() const
+    -> bool { return m_table == nullptr; }
+
+auto rcs::io::slot::index() const
+    -> std::uint32_t { return m_index; }
+
+void rcs::io::slot::reset() {
+    if (m_table == nullptr) return;
+    m_table->release(m_index);
+    m_table = nullptr;
+}
+
+rcs::io::slot::~slot() {
+    slot::reset();
+}
@@ -0,0 +1,189 @@
+#include <rcs/atomic.hpp>
+
+#include <rcs/io/uring/bufr.hpp>
+#include <rcs/io/uring/reg.hpp>
+#include <rcs/io/uring/register.hpp>
+
+#include <rcs/system/exception.hpp>
+
+#include <sys/mman.h>
+
+#include <cassert>
+#include <cerrno>
+#include <cstdint>
+
+namespace {
+
+/// @brief Buffer ring entry.
+struct buf {
+    std::uint64_t address = 0;
+    std::uint32_t size    = 0;
+    std::uint16_t index   = 0;
+    std::uint16_t tail    = 0;
+};
+
+/// @brief Buffer ring registration request.
+struct buf_reg {
+    std::uint64_t address  = 0;
+    std::uint32_t capacity = 0;
+    std::uint16_t group    = 0;
+    std::uint16_t flags    = 0;
+
+    [[maybe_unused]] std::uint64_t _m_resv[3] = {0};
+};
+
+} // namespace
+
+rcs::io::uring::bufr::bufr(
+    rcs::io::uring::bufr &&other) noexcept
+    : m_map(other.m_map),
+      m_data(other.m_data),
+      m_shared(other.m_shared),
+      m_tail(other.m_tail),
+      m_mask(other.m_mask),
+      m_group(other.m_group),
+      m_size(other.m_size),
+      m_descriptor(other.m_descriptor) {
+    other._release();
+}
+
+auto rcs::io::uring::bufr::operator=(
+    rcs::io::uring::bufr &&other) noexcept
+    -> rcs::io::uring::bufr & {
+    _reset();
+
+    m_map        = other.m_map;
+    m_data       = other.m_data;
+    m_shared     = other.m_shared;
+    m_tail       = other.m_tail;
+    m_mask       = other.m_mask;
+    m_group      = other.m_group;
+    m_size       = other.m_size;
+    m_descriptor = other.m_descriptor;
+
+    other._release();
+
+    return *this;
+}
+
+rcs::io::uring::bufr::bufr(
+    std::int32_t  descriptor,
+    std::uint16_t group,
+    std::uint32_t capacity,
+    std::uint32_t size)
+    : rcs::io::uring::bufr() {
+    assert(capacity != 0 and capacity <= MAX_CAPACITY);
+    assert((capacity & (capacity - 1)) == 0);
+
+    m_group = group;
+    m_size  = size;
+    m_mask  = static_cast<std::uint16_t>(capacity - 1);
+
+    m_map.size = capacity * sizeof(buf);
+    m_map.base = reinterpret_cast<std::uint8_t *>(
+        ::mmap(nullptr, m_map.size,
+               PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_POPULATE,
+               -1, 0));
+    if (m_map.base == MAP_FAILED) {
+        m_map = {};
+        throw rcs::system::exception(errno);
+    }
+
+    m_data.size = capacity * size;
+    m_data.base = reinterpret_cast<std::uint8_t *>(
+        ::mmap(nullptr, m_data.size,
+               PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS,
+               -1, 0));
+    if (m_data.base == MAP_FAILED) {
+        m_data = {};
+        _reset();
+        throw rcs::system::exception(errno);
+    }
+
+    // The tail shares the memory with the reserved field of the first entry.
+    m_shared = &reinterpret_cast<buf *>(m_map.base)->tail;
+
+    const buf_reg request = {
+        .address  = reinterpret_cast<std::uint64_t>(m_map.base),
+        .capacity = capacity,
+        .group    = group};
+
+    try {
+        (void)rcs::io::uring::register_(
+            descriptor, rcs::io::uring::reg::pbuf_ring, &request, 1);
+    } catch (...) {
+        _reset();
+        throw;
+    }
+
+    m_descriptor = descriptor;
+
+    for (std::uint32_t index = 0; index < capacity; ++index)
+        _push(static_cast<std::uint16_t>(index));
+    _publish();
+}
+
+auto rcs::io::uring::bufr::group() const
+    -> std::uint16_t { return m_group; }
+
+auto rcs::io::uring::bufr::capacity() const
+    -> std::uint32_t { return m_mask + 1U; }
+
+auto rcs::io::uring::bufr::size() const
+    -> std::uint32_t { return m_size; }
+
+auto rcs::io::uring::bufr::data(std::uint16_t index) const
+    -> std::uint8_t * {
+    assert(index < capacity());
+    return m_data.base + (static_cast<std::size_t>(index) * m_size);
+}
+
+void rcs::io::uring::bufr::provide(std::uint16_t index) {
+    _push(index);
+    _publish();
+}
+
+void rcs::io::uring::bufr::_push(std::uint16_t index) {
+    buf *entry = &reinterpret_cast<buf *>(m_map.base)[m_tail++ & m_mask];
+
+    // Leave the tail untouched when overwriting the first entry.
+    entry->address = reinterpret_cast<std::uint64_t>(data(index));
+    entry->size    = m_size;
+    entry->index   = index;
+}
+
+void rcs::io::uring::bufr::_publish() const {
+    rcs::atomic::release(m_shared, m_tail);
+}
+
+void rcs::io::uring::bufr::_release() {
+    m_map        = {};
+    m_data       = {};
+    m_shared     = nullptr;
+    m_tail       = 0;
+    m_mask       = 0;
+    m_group      = 0;
+    m_size       = 0;
+    m_descriptor = -1;
+}
+
+void rcs::io::uring::bufr::_reset() {
+    if (m_descriptor != -1) {
+        const buf_reg request = {.group = m_group};
+        try {
+            (void)rcs::io::uring::register_(
+                m_descriptor, rcs::io::uring::reg::unregister_pbuf_ring, &request, 1);
+        } catch (...) { // NOLINT(bugprone-empty-catch)
+            // The ring is unregistered anyway once the instance is closed.
+        }
+    }
+    if (m_data.base != nullptr)
+        ::munmap(m_data.base, m_data.size);
+    if (m_map.base != nullptr)
+        ::munmap(m_map.base, m_map.size);
+    _release();
+}
+
+rcs::io::uring::bufr::~bufr() {
+    _reset();
+}
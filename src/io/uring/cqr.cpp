@@ -5,12 +5,16 @@
 #include <rcs/io/uring/cqr.hpp>
 #include <rcs/io/uring/enter.hpp>
 #include <rcs/io/uring/flags.hpp>
+#include <rcs/io/uring/getevents_arg.hpp>
 #include <rcs/io/uring/params.hpp>
+#include <rcs/io/uring/timespec.hpp>
 
 #include <rcs/system/exception.hpp>
 
 #include <sys/mman.h>
 
+#include <algorithm>
+
 #include <cassert>
 #include <cerrno>
 #include <cstdint>
@@ -23,7 +27,8 @@ rcs::io::uring::cqr::cqr(
       m_head(other.m_head),
       m_mask(other.m_mask),
       m_flags(other.m_flags),
-      m_descriptor(other.m_descriptor) {
+      m_descriptor(other.m_descriptor),
+      m_enter(other.m_enter) {
     other._release();
 }
 
@@ -39,6 +44,7 @@ auto rcs::io::uring::cqr::operator=(
     m_mask       = other.m_mask;
     m_flags      = other.m_flags;
     m_descriptor = other.m_descriptor;
+    m_enter      = other.m_enter;
 
     other._release();
 
@@ -61,11 +67,12 @@ rcs::io::uring::cqr::cqr(
     m_ring.base = reinterpret_cast<rcs::io::uring::cqe *>(m_map.base + params.cq_off.ring);
     m_ring.size = params.cq_capacity;
 
-    m_shared.head = reinterpret_cast<std::uint32_t *>(m_map.base + params.cq_off.head);
-    m_shared.tail = reinterpret_cast<std::uint32_t *>(m_map.base + params.cq_off.tail);
-    m_head        = *reinterpret_cast<std::uint32_t *>(m_map.base + params.cq_off.head);
-    m_mask        = *reinterpret_cast<std::uint32_t *>(m_map.base + params.cq_off.mask);
-    m_flags       = *reinterpret_cast<std::uint32_t *>(m_map.base + params.cq_off.flags);
+    m_shared.head     = reinterpret_cast<std::uint32_t *>(m_map.base + params.cq_off.head);
+    m_shared.tail     = reinterpret_cast<std::uint32_t *>(m_map.base + params.cq_off.tail);
+    m_shared.overflow = reinterpret_cast<std::uint32_t *>(m_map.base + params.cq_off.overflow);
+    m_head            = *reinterpret_cast<std::uint32_t *>(m_map.base + params.cq_off.head);
+    m_mask            = *reinterpret_cast<std::uint32_t *>(m_map.base + params.cq_off.mask);
+    m_flags           = *reinterpret_cast<std::uint32_t *>(m_map.base + params.cq_off.flags);
 }
 
 auto rcs::io::uring::cqr::empty() const
@@ -83,13 +90,35 @@ auto rcs::io::uring::cqr::pending() const
 auto rcs::io::uring::cqr::capacity() const
     -> std::uint32_t { return m_ring.size / sizeof(rcs::io::uring::cqe); }
 
+auto rcs::io::uring::cqr::overflow() const
+    -> std::uint32_t { return rcs::atomic::load(m_shared.overflow); }
+
 void rcs::io::uring::cqr::wait(std::uint32_t waitnr) const {
     (void)rcs::io::uring::enter(
         m_descriptor, 0, waitnr,
-        rcs::io::uring::ENTER_GETEVENTS,
+        rcs::io::uring::ENTER_GETEVENTS | m_enter,
         nullptr);
 }
 
+auto rcs::io::uring::cqr::wait(
+    std::uint32_t waitnr, const rcs::io::uring::timespec &timeout) const
+    -> bool {
+    rcs::io::uring::getevents_arg arg;
+    arg.ts = reinterpret_cast<std::uint64_t>(&timeout);
+
+    try {
+        (void)rcs::io::uring::enter(
+            m_descriptor, 0, waitnr,
+            rcs::io::uring::ENTER_GETEVENTS | rcs::io::uring::ENTER_EXT_ARG | m_enter,
+            arg);
+    } catch (const rcs::system::exception &e) {
+        if (e.error_code() != ETIME) throw;
+        return false;
+    }
+
+    return true;
+}
+
 auto rcs::io::uring::cqr::next()
     -> const rcs::io::uring::cqe & {
     assert(not empty());
@@ -97,10 +126,27 @@ auto rcs::io::uring::cqr::next()
     return m_ring.base[m_head++ & m_mask];
 }
 
+auto rcs::io::uring::cqr::next(
+    rcs::io::uring::cqe *entries, std::uint32_t max)
+    -> std::uint32_t {
+    const std::uint32_t tail  = rcs::atomic::acquire(m_shared.tail);
+    const std::uint32_t count = std::min(tail - m_head, max);
+
+    for (std::uint32_t index = 0; index < count; ++index)
+        entries[index] = m_ring.base[m_head++ & m_mask];
+
+    return count;
+}
+
 void rcs::io::uring::cqr::seen() const {
     rcs::atomic::release(m_shared.head, m_head);
 }
 
+void rcs::io::uring::cqr::registered(std::int32_t index) {
+    m_descriptor = index;
+    m_enter      = rcs::io::uring::ENTER_REGISTERED_RING;
+}
+
 void rcs::io::uring::cqr::_release() {
     m_map        = {};
     m_ring       = {};
@@ -109,6 +155,7 @@ void rcs::io::uring::cqr::_release() {
     m_mask       = 0;
     m_flags      = 0;
     m_descriptor = -1;
+    m_enter      = 0;
 }
 
 void rcs::io::uring::cqr::_reset() {
@@ -1,4 +1,5 @@
 #include <rcs/io/uring/enter.hpp>
+#include <rcs/io/uring/getevents_arg.hpp>
 #include <rcs/system/exception.hpp>
 
 #include <asm/unistd_64.h>
@@ -23,3 +24,19 @@ auto rcs::io::uring::enter(
     if (consumed == -1) throw rcs::system::exception(errno);
     return static_cast<std::uint32_t>(consumed);
 }
+
+auto rcs::io::uring::enter(
+    std::int32_t                         descriptor,
+    std::uint32_t                        submitnr,
+    std::uint32_t                        waitnr,
+    std::uint32_t                        flags,
+    const rcs::io::uring::getevents_arg &arg) -> std::uint32_t {
+    const int consumed = (int)syscall(
+        __NR_io_uring_enter,
+        descriptor,
+        submitnr,
+        waitnr,
+        flags, &arg, sizeof(arg));
+    if (consumed == -1) throw rcs::system::exception(errno);
+    return static_cast<std::uint32_t>(consumed);
+}
@@ -0,0 +1,17 @@
+#include <rcs/io/uring/msg_ring.hpp>
+#include <rcs/io/uring/op.hpp>
+#include <rcs/io/uring/reg.hpp>
+#include <rcs/io/uring/register.hpp>
+#include <rcs/io/uring/sqe.hpp>
+
+#include <cstdint>
+
+void rcs::io::uring::msg_ring(std::int32_t descriptor, std::uint64_t token, std::int32_t result) {
+    rcs::io::uring::sqe entry;
+    entry.opcode     = rcs::io::uring::op::msg_ring;
+    entry.descriptor = descriptor;
+    entry.offset     = token;
+    entry.bufsize    = static_cast<std::uint32_t>(result);
+
+    (void)rcs::io::uring::register_(-1, rcs::io::uring::reg::send_msg_ring, &entry, 1);
+}
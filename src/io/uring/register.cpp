@@ -0,0 +1,49 @@
+#include <rcs/io/uring/reg.hpp>
+#include <rcs/io/uring/register.hpp>
+#include <rcs/system/exception.hpp>
+
+#include <asm/unistd_64.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdint>
+
+namespace {
+
+/// @brief Registered resource update request.
+struct rsrc_update {
+    std::uint32_t offset = 0;
+
+    [[maybe_unused]] std::uint32_t _m_resv = 0;
+
+    std::uint64_t data = 0;
+};
+
+} // namespace
+
+auto rcs::io::uring::register_(
+    std::int32_t        descriptor,
+    rcs::io::uring::reg opcode,
+    const void         *arg,
+    std::uint32_t       nr) -> std::int32_t {
+    const int ret = (int)syscall(
+        __NR_io_uring_register,
+        descriptor,
+        static_cast<std::uint32_t>(opcode),
+        arg, nr);
+    if (ret == -1) throw rcs::system::exception(errno);
+    return ret;
+}
+
+auto rcs::io::uring::register_ring(std::int32_t descriptor)
+    -> std::int32_t {
+    // Let the kernel pick a free index.
+    rsrc_update update;
+    update.offset = ~0U;
+    update.data   = static_cast<std::uint64_t>(descriptor);
+
+    (void)rcs::io::uring::register_(
+        descriptor, rcs::io::uring::reg::ring_fds, &update, 1);
+
+    return static_cast<std::int32_t>(update.offset);
+}
@@ -11,6 +11,8 @@
 
 #include <sys/mman.h>
 
+#include <atomic>
+
 #include <cassert>
 #include <cerrno>
 #include <cstdint>
@@ -23,7 +25,9 @@ rcs::io::uring::sqr::sqr(
       m_tail(other.m_tail),
       m_mask(other.m_mask),
       m_flags(other.m_flags),
-      m_descriptor(other.m_descriptor) {
+      m_wakeups(other.m_wakeups),
+      m_descriptor(other.m_descriptor),
+      m_enter(other.m_enter) {
     other._release();
 }
 
@@ -38,7 +42,9 @@ auto rcs::io::uring::sqr::operator=(
     m_tail       = other.m_tail;
     m_mask       = other.m_mask;
     m_flags      = other.m_flags;
+    m_wakeups    = other.m_wakeups;
     m_descriptor = other.m_descriptor;
+    m_enter      = other.m_enter;
 
     other._release();
 
@@ -69,10 +75,11 @@ rcs::io::uring::sqr::sqr(
     if (m_ring.base == MAP_FAILED) throw rcs::system::exception(errno);
 
     m_shared.head = reinterpret_cast<std::uint32_t *>(m_map.base + params.sq_off.head);
-    m_shared.tail = reinterpret_cast<std::uint32_t *>(m_map.base + params.sq_off.tail);
-    m_tail        = *reinterpret_cast<std::uint32_t *>(m_map.base + params.sq_off.tail);
-    m_mask        = *reinterpret_cast<std::uint32_t *>(m_map.base + params.sq_off.mask);
-    m_flags       = *reinterpret_cast<std::uint32_t *>(m_map.base + params.sq_off.flags);
+    m_shared.tail  = reinterpret_cast<std::uint32_t *>(m_map.base + params.sq_off.tail);
+    m_shared.flags = reinterpret_cast<std::uint32_t *>(m_map.base + params.sq_off.flags);
+    m_tail         = *reinterpret_cast<std::uint32_t *>(m_map.base + params.sq_off.tail);
+    m_mask         = *reinterpret_cast<std::uint32_t *>(m_map.base + params.sq_off.mask);
+    m_flags        = params.flags;
 
     if ((params.flags & rcs::io::uring::SETUP_NO_SQARRAY) == 0) {
         std::uint32_t *array =
@@ -95,6 +102,9 @@ auto rcs::io::uring::sqr::full() const
 auto rcs::io::uring::sqr::pending() const
     -> std::uint32_t { return m_tail - rcs::atomic::acquire(m_shared.head); }
 
+auto rcs::io::uring::sqr::staged() const
+    -> std::uint32_t { return m_tail - rcs::atomic::load(m_shared.tail); }
+
 auto rcs::io::uring::sqr::capacity() const
     -> std::uint32_t { return m_ring.size / sizeof(rcs::io::uring::sqe); }
 
@@ -109,15 +119,55 @@ auto rcs::io::uring::sqr::next()
     return *entry;
 }
 
+auto rcs::io::uring::sqr::polled() const
+    -> bool { return (m_flags & rcs::io::uring::SETUP_SQPOLL) != 0; }
+
+auto rcs::io::uring::sqr::wakeup() const
+    -> bool {
+    // The tail store must not be reordered with the flags load, otherwise
+    // the thread may go to sleep without having seen the new entries.
+    std::atomic_thread_fence(std::memory_order::seq_cst);
+    return (rcs::atomic::load(m_shared.flags) & rcs::io::uring::SQ_NEED_WAKEUP) != 0;
+}
+
+auto rcs::io::uring::sqr::wakeups() const
+    -> std::uint64_t { return m_wakeups; }
+
+auto rcs::io::uring::sqr::taskrun() const
+    -> bool { return (rcs::atomic::load(m_shared.flags) & rcs::io::uring::SQ_TASKRUN) != 0; }
+
 auto rcs::io::uring::sqr::submit()
-    const -> std::uint32_t {
+    -> std::uint32_t {
     assert(not empty());
 
+    if (sqr::polled()) {
+        const std::uint32_t published = sqr::staged();
+        rcs::atomic::release(m_shared.tail, m_tail);
+        if (sqr::wakeup()) {
+            (void)rcs::io::uring::enter(
+                m_descriptor, 0, 0,
+                rcs::io::uring::ENTER_SQ_WAKEUP | m_enter, nullptr);
+            ++m_wakeups;
+        }
+        return published;
+    }
+
     rcs::atomic::release(m_shared.tail, m_tail);
     return rcs::io::uring::enter(
         m_descriptor,
         sqr::pending(),
-        0, 0, nullptr);
+        0, m_enter, nullptr);
+}
+
+auto rcs::io::uring::sqr::flush()
+    const -> std::uint32_t {
+    rcs::atomic::release(m_shared.tail, m_tail);
+    return sqr::pending();
+}
+
+void rcs::io::uring::sqr::registered(std::int32_t index) {
+    m_descriptor = index;
+    m_enter      = rcs::io::uring::ENTER_REGISTERED_RING;
 }
 
 void rcs::io::uring::sqr::_release() {
@@ -127,7 +177,9 @@ void rcs::io::uring::sqr::_release() {
     m_tail       = 0;
     m_mask       = 0;
     m_flags      = 0;
+    m_wakeups    = 0;
     m_descriptor = -1;
+    m_enter      = 0;
 }
 
 void rcs::io::uring::sqr::_reset() {
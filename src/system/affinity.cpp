@@ -0,0 +1,30 @@
+#include <rcs/system/affinity.hpp>
+#include <rcs/system/exception.hpp>
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <cerrno>
+
+auto rcs::system::cpus()
+    -> std::vector<std::int32_t> {
+    ::cpu_set_t set;
+    CPU_ZERO(&set);
+    if (-1 == ::sched_getaffinity(0, sizeof(set), &set))
+        throw rcs::system::exception(errno);
+
+    std::vector<std::int32_t> cpus;
+    for (std::int32_t cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+        if (CPU_ISSET(cpu, &set)) cpus.push_back(cpu);
+
+    return cpus;
+}
+
+void rcs::system::pin(std::int32_t cpu) {
+    ::cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+
+    const std::int32_t rv = ::pthread_setaffinity_np(::pthread_self(), sizeof(set), &set);
+    if (0 != rv) throw rcs::system::exception(rv);
+}
@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+
+#include <rcs/co/awaitable.hpp>
+#include <rcs/execution/inline_executor.hpp>
+#include <rcs/io/service.hpp>
+
+#include <unistd.h>
+
+#include <array>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+
+#include <cstdint>
+
+namespace {
+
+// Heap allocations made by the current thread.
+thread_local std::uint64_t allocations = 0;
+
+} // namespace
+
+// The replacements pair malloc with free, which GCC cannot tell once it
+// inlines them into the new-expressions of this file.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+
+auto operator new(std::size_t size) -> void * {
+    ++allocations;
+    if (void *pointer = std::malloc(size == 0 ? 1 : size); pointer != nullptr) return pointer;
+    throw std::bad_alloc();
+}
+
+void operator delete(void *pointer) noexcept { std::free(pointer); }
+void operator delete(void *pointer, std::size_t size) noexcept { (void)size, std::free(pointer); }
+
+#pragma GCC diagnostic pop
+
+namespace {
+
+using service_t = rcs::io::service<rcs::execution::inline_executor>;
+
+constexpr std::uint32_t ROUNDS = 64;
+
+auto exchange(service_t &service, std::int32_t in, std::int32_t out, std::uint32_t &transferred,
+              std::uint64_t &allocated)
+    -> rcs::co::awaitable<void> {
+    std::array<char, 1> data = {'x'};
+
+    const std::uint64_t before = allocations;
+    for (std::uint32_t round = 0; round < ROUNDS; ++round) {
+        std::int32_t rv = co_await service.write(out, data.data(), data.size());
+        transferred += rv;
+        rv = co_await service.read(in, data.data(), data.size());
+        transferred += rv;
+        rv = co_await service.write_for(out, data.data(), data.size(), std::chrono::seconds(10));
+        transferred += rv;
+        rv = co_await service.read_for(in, data.data(), data.size(), std::chrono::seconds(10));
+        transferred += rv;
+    }
+    allocated = allocations - before;
+}
+
+TEST(io_allocation, operations_shouldNotAllocate) {
+    service_t                   service({}, 8);
+    std::array<std::int32_t, 2> pipe = {-1, -1};
+    ASSERT_EQ(0, ::pipe(pipe.data()));
+
+    std::uint32_t transferred = 0;
+    std::uint64_t allocated   = ~0ULL;
+    {
+        const rcs::co::awaitable<void> task = exchange(service, pipe[0], pipe[1], transferred, allocated);
+        service.run();
+        task.rethrow_exception();
+    }
+
+    ::close(pipe[0]), ::close(pipe[1]);
+    EXPECT_EQ(4 * ROUNDS, transferred);
+    EXPECT_EQ(0U, allocated);
+}
+
+} // namespace
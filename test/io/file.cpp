@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+
+#include <rcs/co/awaitable.hpp>
+#include <rcs/execution/inline_executor.hpp>
+#include <rcs/io/file.hpp>
+#include <rcs/io/service.hpp>
+#include <rcs/io/slice.hpp>
+
+#include <rcs/system/exception.hpp>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <string>
+#include <string_view>
+
+#include <cstdint>
+
+namespace {
+
+using service_t = rcs::io::service<rcs::execution::inline_executor>;
+using file_t    = rcs::io::file<rcs::execution::inline_executor>;
+
+/// @brief Path of a file removed once the test is done.
+class path_t final {
+  public:
+    explicit path_t(std::string_view name)
+        : value("/tmp/rcs-" + std::string(name) + "-" + std::to_string(::getpid())) {}
+    ~path_t() { ::unlink(value.c_str()); }
+
+    path_t(const path_t &)                     = delete;
+    path_t(path_t &&)                          = delete;
+    auto operator=(const path_t &) -> path_t & = delete;
+    auto operator=(path_t &&) -> path_t      & = delete;
+
+    std::string value;
+};
+
+auto roundtrip(service_t &service, std::string path, std::string &read, std::uint64_t &size)
+    -> rcs::co::awaitable<void> {
+    file_t file(service);
+    co_await file.open(path, O_RDWR | O_CREAT | O_TRUNC);
+    EXPECT_FALSE(file.direct());
+
+    // Written back to front, so that the offsets are what places the data.
+    EXPECT_EQ(5U, co_await file.write("world", 5, 6));
+    EXPECT_EQ(6U, co_await file.write("hello ", 6, 0));
+    co_await file.datasync();
+
+    std::array<char, 16> data = {};
+    const std::uint32_t  rv   = co_await file.read(data.data(), data.size(), 0);
+    read.assign(data.data(), rv);
+
+    co_await file.allocate(0, 4096);
+    co_await file.sync();
+    size = co_await file.size();
+
+    co_await file.close();
+    EXPECT_EQ(-1, file.descriptor());
+}
+
+auto open(service_t &service, std::string path) -> rcs::co::awaitable<std::int32_t> {
+    file_t file(service);
+    try {
+        co_await file.open(path, O_RDONLY);
+    } catch (const rcs::system::exception &e) {
+        co_return e.error_code();
+    }
+    co_return 0;
+}
+
+auto direct(service_t &service, std::string path, bool &supported, bool &equal)
+    -> rcs::co::awaitable<void> {
+    file_t file(service);
+    try {
+        co_await file.open(path, O_RDWR | O_CREAT | O_TRUNC | O_DIRECT);
+    } catch (const rcs::system::exception &e) {
+        // Not every file system supports direct I/O.
+        if (e.error_code() == EINVAL) co_return;
+        throw;
+    }
+    supported = true;
+    EXPECT_TRUE(file.direct());
+
+    const rcs::io::slice source = file.acquire();
+    const rcs::io::slice target = file.acquire();
+    std::memset(source.data(), 'x', source.size());
+
+    const std::uint32_t size = file.alignment();
+    EXPECT_EQ(size, co_await file.write(source, size, size));
+    EXPECT_EQ(size, co_await file.read(target, size, size));
+    equal = std::memcmp(source.data(), target.data(), size) == 0;
+
+    co_await file.close();
+}
+
+TEST(io_file, operations_shouldRunThroughService) {
+    service_t    service({}, 8);
+    const path_t path("file");
+
+    std::string   read;
+    std::uint64_t size = 0;
+    const auto    task = roundtrip(service, path.value, read, size);
+    service.run();
+    task.rethrow_exception();
+
+    EXPECT_EQ("hello world", read);
+    EXPECT_EQ(4096U, size);
+}
+
+TEST(io_file, open_shouldThrowErrorCode) {
+    service_t service({}, 8);
+
+    const auto error = open(service, "/tmp/rcs-missing/file");
+    service.run();
+    EXPECT_EQ(ENOENT, error.result());
+}
+
+TEST(io_file, direct_file_shouldTransferThroughAlignedBuffers) {
+    service_t    service({}, 8);
+    const path_t path("direct");
+    (void)service.register_buffers(2, 65536);
+
+    bool       supported = false;
+    bool       equal     = false;
+    const auto task      = direct(service, path.value, supported, equal);
+    service.run();
+    task.rethrow_exception();
+
+    if (not supported) GTEST_SKIP();
+    EXPECT_TRUE(equal);
+}
+
+} // namespace
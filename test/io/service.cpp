@@ -0,0 +1,952 @@
+#include <gtest/gtest.h>
+
+#include <rcs/co/awaitable.hpp>
+#include <rcs/execution/inline_executor.hpp>
+#include <rcs/io/buffer_arena.hpp>
+#include <rcs/io/buffer_ring.hpp>
+#include <rcs/io/cancellation.hpp>
+#include <rcs/io/capabilities.hpp>
+#include <rcs/io/file_table.hpp>
+#include <rcs/io/lease.hpp>
+#include <rcs/io/options.hpp>
+#include <rcs/io/pipe.hpp>
+#include <rcs/io/pipe_pool.hpp>
+#include <rcs/io/service.hpp>
+#include <rcs/io/slice.hpp>
+#include <rcs/io/slot.hpp>
+#include <rcs/io/uring/flags.hpp>
+#include <rcs/io/uring/op.hpp>
+#include <rcs/io/uring/reg.hpp>
+
+#include <rcs/system/exception.hpp>
+
+#include <linux/filter.h>
+#include <linux/seccomp.h>
+#include <netinet/in.h>
+#include <sys/prctl.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <cstdint>
+
+namespace {
+
+using service_t = rcs::io::service<rcs::execution::inline_executor>;
+
+class pipe_t final {
+  public:
+    pipe_t() { EXPECT_EQ(0, ::pipe(descriptors.data())); }
+    ~pipe_t() { ::close(descriptors[0]), ::close(descriptors[1]); }
+
+    pipe_t(const pipe_t &)                     = delete;
+    pipe_t(pipe_t &&)                          = delete;
+    auto operator=(const pipe_t &) -> pipe_t & = delete;
+    auto operator=(pipe_t &&) -> pipe_t      & = delete;
+
+    [[nodiscard]] auto in() const -> std::int32_t { return descriptors[0]; }
+    [[nodiscard]] auto out() const -> std::int32_t { return descriptors[1]; }
+
+  private:
+    std::array<std::int32_t, 2> descriptors = {-1, -1};
+};
+
+class socketpair_t final {
+  public:
+    socketpair_t() { EXPECT_EQ(0, ::socketpair(AF_UNIX, SOCK_STREAM, 0, descriptors.data())); }
+    ~socketpair_t() { ::close(descriptors[0]), ::close(descriptors[1]); }
+
+    socketpair_t(const socketpair_t &)                     = delete;
+    socketpair_t(socketpair_t &&)                          = delete;
+    auto operator=(const socketpair_t &) -> socketpair_t & = delete;
+    auto operator=(socketpair_t &&) -> socketpair_t      & = delete;
+
+    [[nodiscard]] auto left() const -> std::int32_t { return descriptors[0]; }
+    [[nodiscard]] auto right() const -> std::int32_t { return descriptors[1]; }
+
+  private:
+    std::array<std::int32_t, 2> descriptors = {-1, -1};
+};
+
+auto write(service_t &service, std::int32_t descriptor, const char *data, std::uint32_t size,
+           std::uint8_t flags = 0)
+    -> rcs::co::awaitable<std::int32_t> {
+    co_return co_await service.write(descriptor, data, size, 0, flags);
+}
+
+template <typename TAwaiter>
+auto start(TAwaiter awaiter) -> rcs::co::awaitable<std::int32_t> {
+    co_return co_await awaiter;
+}
+
+TEST(io_service, immediate_submission_shouldEnterOncePerOperation) {
+    service_t    service({}, 8);
+    const pipe_t pipe;
+
+    std::vector<rcs::co::awaitable<std::int32_t>> writes;
+    for (int i = 0; i < 4; ++i)
+        writes.push_back(write(service, pipe.out(), "x", 1));
+    service.run();
+
+    for (const auto &w : writes) EXPECT_EQ(1, w.result());
+    EXPECT_EQ(4U, service.stats().enters);
+    EXPECT_EQ(4U, service.stats().submitted);
+}
+
+TEST(io_service, deferred_submission_shouldSubmitStagedEntriesAtOnce) {
+    service_t    service({}, 8, {.submission = rcs::io::submission::deferred});
+    const pipe_t pipe;
+
+    std::vector<rcs::co::awaitable<std::int32_t>> writes;
+    for (int i = 0; i < 4; ++i)
+        writes.push_back(write(service, pipe.out(), "x", 1));
+
+    EXPECT_EQ(0U, service.stats().enters);
+    service.run();
+
+    for (const auto &w : writes) EXPECT_EQ(1, w.result());
+    EXPECT_EQ(1U, service.stats().enters);
+    EXPECT_EQ(4U, service.stats().submitted);
+}
+
+TEST(io_service, staging_shouldAcceptConcurrentProducers) {
+    constexpr std::uint32_t PRODUCERS = 4;
+    constexpr std::uint32_t COUNT     = 256;
+
+    service_t                  service({}, 64);
+    const pipe_t               pipe;
+    std::atomic<std::uint32_t> finished = 0;
+
+    std::array<std::vector<rcs::co::awaitable<std::int32_t>>, PRODUCERS> writes;
+    std::vector<std::thread>                                             producers;
+    for (std::uint32_t index = 0; index < PRODUCERS; ++index) {
+        producers.emplace_back([&, index] {
+            for (std::uint32_t i = 0; i < COUNT; ++i)
+                writes[index].push_back(write(service, pipe.out(), "x", 1));
+            finished.fetch_add(1);
+        });
+    }
+
+    while (finished.load() < PRODUCERS or not service.idle()) (void)service.run_batch();
+    for (std::thread &producer : producers) producer.join();
+
+    for (const auto &w : writes)
+        for (const auto &r : w) EXPECT_EQ(1, r.result());
+
+    std::array<char, PRODUCERS * COUNT> data = {};
+    EXPECT_EQ(static_cast<::ssize_t>(data.size()), ::read(pipe.in(), data.data(), data.size()));
+}
+
+auto polled(const rcs::io::options &options) -> std::unique_ptr<service_t> {
+    try {
+        return std::make_unique<service_t>(rcs::execution::inline_executor{}, 8, options);
+    } catch (const rcs::system::exception &) {
+        return nullptr;
+    }
+}
+
+TEST(io_service, sqpoll_shouldSubmitWithoutEnteringTheKernel) {
+    const auto service = polled({.sqpoll = {.enabled = true}});
+    if (service == nullptr) GTEST_SKIP();
+    const pipe_t pipe;
+
+    std::vector<rcs::co::awaitable<std::int32_t>> writes;
+    for (int i = 0; i < 4; ++i)
+        writes.push_back(write(*service, pipe.out(), "x", 1));
+    service->run();
+
+    for (const auto &w : writes) EXPECT_EQ(1, w.result());
+    EXPECT_EQ(4U, service->stats().submitted);
+    EXPECT_EQ(0U, service->stats().enters);
+}
+
+TEST(io_service, sqpoll_shouldWakeUpSleepingThread) {
+    const auto service = polled({.submission = rcs::io::submission::deferred,
+                                 .sqpoll     = {.enabled = true, .idle = 1}});
+    if (service == nullptr) GTEST_SKIP();
+    const pipe_t pipe;
+
+    // Let the polling thread go to sleep.
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    const auto w = write(*service, pipe.out(), "x", 1);
+    service->run();
+
+    EXPECT_EQ(1, w.result());
+    EXPECT_EQ(1U, service->stats().enters);
+}
+
+TEST(io_service, capabilities_shouldReflectRunningKernel) {
+    service_t    service({}, 8);
+    const pipe_t pipe;
+
+    const rcs::io::capabilities &capabilities = service.capabilities();
+    EXPECT_TRUE(capabilities.supports(rcs::io::uring::op::read));
+    EXPECT_TRUE(capabilities.supports(rcs::io::uring::op::write));
+    EXPECT_FALSE(capabilities.supports(static_cast<rcs::io::uring::op>(255)));
+    EXPECT_NE(0U, capabilities.features() & rcs::io::uring::FEAT_NODROP);
+
+    // Multishot receives arrived after multishot accept.
+    EXPECT_TRUE(not capabilities.multishot_recv() or capabilities.multishot());
+
+    // The submission queue is usable with or without the indirection array.
+    const auto w = write(service, pipe.out(), "x", 1);
+    service.run();
+    EXPECT_EQ(1, w.result());
+}
+
+TEST(io_service, cooperative_profile_shouldCompleteOperations) {
+    service_t    service({}, 8, {.profile = rcs::io::profile::cooperative});
+    const pipe_t pipe;
+
+    std::vector<rcs::co::awaitable<std::int32_t>> writes;
+    for (int i = 0; i < 4; ++i)
+        writes.push_back(write(service, pipe.out(), "x", 1));
+    service.run();
+
+    for (const auto &w : writes) EXPECT_EQ(1, w.result());
+    EXPECT_EQ(rcs::io::profile::cooperative, service.options().profile);
+}
+
+TEST(io_service, single_issuer_profile_shouldBeDrivenByFirstRunningThread) {
+    service_t    service({}, 8, {.profile = rcs::io::profile::single_issuer,
+                                 .wait    = {.spin = std::chrono::milliseconds(1)}});
+    const pipe_t pipe;
+
+    EXPECT_EQ(rcs::io::profile::single_issuer, service.options().profile);
+    EXPECT_EQ(rcs::io::submission::deferred, service.options().submission);
+
+    // Initiated here, but submitted by the thread running the loop.
+    char       data = 0;
+    const auto r    = start(service.read(pipe.in(), &data, 1));
+    const auto w    = write(service, pipe.out(), "x", 1);
+
+    std::thread issuer([&] {
+        service.run();
+
+        // The loop keeps driving the ring on later runs.
+        const auto again = write(service, pipe.out(), "y", 1);
+        service.run();
+        EXPECT_EQ(1, again.result());
+    });
+    issuer.join();
+
+    EXPECT_EQ(1, w.result());
+    EXPECT_EQ(1, r.result());
+    EXPECT_EQ('x', data);
+}
+
+TEST(io_service, single_issuer_profile_shouldLeaveOverflowToIssuer) {
+    service_t    service({}, 2, {.profile = rcs::io::profile::single_issuer});
+    const pipe_t pipe;
+
+    // The thread running the loop becomes the issuer.
+    char       data = 0;
+    const auto r    = start(service.read(pipe.in(), &data, 1));
+    EXPECT_EQ(0U, service.run_for(std::chrono::milliseconds(1)));
+
+    // More detached operations than the submission queue holds, staged by
+    // a thread that must not enter the ring.
+    std::thread producer([&] {
+        for (int i = 0; i < 8; ++i) service.write_detached(pipe.out(), "x", 1);
+    });
+    producer.join();
+    service.run();
+
+    EXPECT_EQ(1, r.result());
+    EXPECT_EQ(0U, service.stats().failures);
+
+    std::array<char, 8> rest = {};
+    EXPECT_EQ(7, ::read(pipe.in(), rest.data(), rest.size()));
+}
+
+TEST(io_service, run_batch_shouldReapAvailableCompletionsAtOnce) {
+    service_t    service({}, 8);
+    const pipe_t pipe;
+
+    std::vector<rcs::co::awaitable<std::int32_t>> writes;
+    for (int i = 0; i < 4; ++i)
+        writes.push_back(write(service, pipe.out(), "x", 1));
+
+    EXPECT_EQ(4U, service.run_batch());
+    EXPECT_TRUE(service.idle());
+
+    for (const auto &w : writes) EXPECT_EQ(1, w.result());
+    EXPECT_EQ(1U, service.stats().reaps);
+    EXPECT_EQ(4U, service.stats().completions);
+}
+
+TEST(io_service, run_batch_shouldNotExceedMaximum) {
+    service_t    service({}, 8);
+    const pipe_t pipe;
+
+    std::vector<rcs::co::awaitable<std::int32_t>> writes;
+    for (int i = 0; i < 4; ++i)
+        writes.push_back(write(service, pipe.out(), "x", 1));
+
+    EXPECT_EQ(3U, service.run_batch(3));
+    EXPECT_EQ(1U, service.pending());
+    EXPECT_EQ(1U, service.run_batch(3));
+}
+
+TEST(io_service, run_for_shouldReturnOnceTimeHasPassed) {
+    service_t    service({}, 8);
+    const pipe_t pipe;
+
+    char       data = 0;
+    const auto r    = start(service.read(pipe.in(), &data, 1));
+
+    const auto started = std::chrono::steady_clock::now();
+    EXPECT_EQ(0U, service.run_for(std::chrono::milliseconds(20)));
+    EXPECT_GE(std::chrono::steady_clock::now() - started, std::chrono::milliseconds(20));
+    EXPECT_FALSE(service.idle());
+
+    EXPECT_EQ(1, ::write(pipe.out(), "x", 1));
+    EXPECT_EQ(1U, service.run_until(std::chrono::steady_clock::now() + std::chrono::seconds(10)));
+    EXPECT_EQ(1, r.result());
+    EXPECT_TRUE(service.idle());
+}
+
+TEST(io_service, run_for_shouldSubmitDeferredEntries) {
+    service_t    service({}, 8, {.submission = rcs::io::submission::deferred});
+    const pipe_t pipe;
+
+    const auto w = write(service, pipe.out(), "x", 1);
+    EXPECT_EQ(1U, service.run_for(std::chrono::seconds(10)));
+    EXPECT_EQ(1, w.result());
+}
+
+TEST(io_service, wait_policy_shouldSpinBeforeBlocking) {
+    service_t    service({}, 8, {.wait = {.spin = std::chrono::milliseconds(5)}});
+    const pipe_t pipe;
+
+    char       data = 0;
+    const auto r    = start(service.read(pipe.in(), &data, 1));
+
+    // Completes while the loop spins, or once it has blocked.
+    std::thread writer([&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        EXPECT_EQ(1, ::write(pipe.out(), "x", 1));
+    });
+    service.run();
+    writer.join();
+
+    EXPECT_EQ(1, r.result());
+
+    // Spinning gives up once the time has passed.
+    const auto t = start(service.read(pipe.in(), &data, 1));
+    EXPECT_EQ(0U, service.run_for(std::chrono::milliseconds(20)));
+    EXPECT_EQ(1, ::write(pipe.out(), "x", 1));
+    service.run();
+    EXPECT_EQ(1, t.result());
+}
+
+TEST(io_service, admission_shouldHoldOperationsBeyondBandwidthInOrder) {
+    service_t    service({}, 2);
+    const pipe_t pipe;
+
+    constexpr std::string_view message = "abcdef";
+
+    std::vector<rcs::co::awaitable<std::int32_t>> writes;
+    for (const char &c : message)
+        writes.push_back(write(service, pipe.out(), &c, 1));
+
+    EXPECT_EQ(2U, service.pending());
+    EXPECT_EQ(4U, service.queued());
+    service.run();
+
+    for (const auto &w : writes) EXPECT_EQ(1, w.result());
+    EXPECT_EQ(4U, service.stats().admissions);
+    EXPECT_EQ(0U, service.stats().overflow);
+
+    std::array<char, message.size()> data = {};
+    EXPECT_EQ(static_cast<::ssize_t>(data.size()), ::read(pipe.in(), data.data(), data.size()));
+    EXPECT_EQ(message, std::string_view(data.data(), data.size()));
+}
+
+TEST(io_service, admission_shouldCompleteCancelledHeldOperations) {
+    service_t    service({}, 1);
+    const pipe_t pipe;
+
+    const std::int32_t listener = ::socket(AF_INET, SOCK_STREAM, 0);
+    struct ::sockaddr_in address = {.sin_family = AF_INET, .sin_port = 0, .sin_addr = {htonl(INADDR_LOOPBACK)}, .sin_zero = {}};
+    ASSERT_EQ(0, ::bind(listener, reinterpret_cast<struct ::sockaddr *>(&address), sizeof(address)));
+    ASSERT_EQ(0, ::listen(listener, 1));
+
+    // Occupy the only slot with a read that waits for data.
+    char       data = 0;
+    const auto r    = start(service.read(pipe.in(), &data, 1));
+
+    auto connections = service.accept_multishot(listener);
+    EXPECT_EQ(1U, service.queued());
+
+    // Closing the stream takes the held operation out of the queue.
+    connections.close();
+    service.run_one();
+    EXPECT_EQ(0U, service.queued());
+
+    EXPECT_EQ(1, ::write(pipe.out(), "x", 1));
+    service.run();
+    EXPECT_EQ(1, r.result());
+    EXPECT_TRUE(service.idle());
+
+    ::close(listener);
+}
+
+TEST(io_service, busy_shouldHoldBeyondBandwidth) {
+    service_t    service({}, 2);
+    const pipe_t pipe;
+
+    // The deadline takes the second slot, and posted work skips admission.
+    char       data = 0;
+    bool       ran  = false;
+    const auto r    = start(service.read_for(pipe.in(), &data, 1, std::chrono::seconds(10)));
+    service.post([&ran] { ran = true; });
+    EXPECT_LT(service.bandwidth(), service.pending());
+    EXPECT_TRUE(service.busy());
+
+    EXPECT_EQ(1, ::write(pipe.out(), "x", 1));
+    service.run();
+    EXPECT_EQ(1, r.result());
+    EXPECT_TRUE(ran);
+    EXPECT_FALSE(service.busy());
+}
+
+TEST(io_service, read_for_shouldTimeOut) {
+    service_t    service({}, 8);
+    const pipe_t pipe;
+
+    char       data = 0;
+    const auto r    = start(service.read_for(pipe.in(), &data, 1, std::chrono::milliseconds(10)));
+    service.run();
+
+    EXPECT_EQ(-ETIME, r.result());
+    EXPECT_TRUE(service.idle());
+}
+
+TEST(io_service, read_for_shouldCompleteBeforeDeadline) {
+    service_t    service({}, 8);
+    const pipe_t pipe;
+
+    EXPECT_EQ(1, ::write(pipe.out(), "x", 1));
+
+    char       data = 0;
+    const auto r    = start(service.read_for(pipe.in(), &data, 1, std::chrono::seconds(10)));
+    service.run();
+
+    EXPECT_EQ(1, r.result());
+    EXPECT_EQ('x', data);
+}
+
+TEST(io_service, cancellation_shouldCancelPendingOperation) {
+    service_t             service({}, 8);
+    const pipe_t          pipe;
+    rcs::io::cancellation cancellation;
+
+    char       data = 0;
+    const auto r    = start(service.read_for(pipe.in(), &data, 1, std::chrono::seconds(10), 0, 0, &cancellation));
+
+    cancellation.cancel();
+    service.run();
+
+    EXPECT_EQ(-ECANCELED, r.result());
+    EXPECT_TRUE(service.idle());
+}
+
+TEST(io_service, cancellation_shouldApplyToNextOperation) {
+    service_t             service({}, 8);
+    const pipe_t          pipe;
+    rcs::io::cancellation cancellation;
+
+    cancellation.cancel();
+
+    char       data = 0;
+    const auto r    = start(service.read(pipe.in(), &data, 1, 0, 0, &cancellation));
+    service.run();
+
+    EXPECT_EQ(-ECANCELED, r.result());
+}
+
+TEST(io_service, vectored_operations_shouldTransferMultipleBuffers) {
+    service_t    service({}, 8);
+    const pipe_t pipe;
+
+    std::array<char, 6>                 header = {'h', 'e', 'a', 'd', 'e', 'r'};
+    std::array<char, 4>                 body   = {'b', 'o', 'd', 'y'};
+    const std::array<struct ::iovec, 2> source = {{
+        {.iov_base = header.data(), .iov_len = header.size()},
+        {.iov_base = body.data(), .iov_len = body.size()}}};
+
+    std::array<char, 4>                 first  = {};
+    std::array<char, 6>                 second = {};
+    const std::array<struct ::iovec, 2> target = {{
+        {.iov_base = first.data(), .iov_len = first.size()},
+        {.iov_base = second.data(), .iov_len = second.size()}}};
+
+    const auto w = start(service.writev(pipe.out(), source.data(), source.size()));
+    const auto r = start(service.readv(pipe.in(), target.data(), target.size()));
+    service.run();
+
+    EXPECT_EQ(10, w.result());
+    EXPECT_EQ(10, r.result());
+    EXPECT_EQ("head", std::string_view(first.data(), first.size()));
+    EXPECT_EQ("erbody", std::string_view(second.data(), second.size()));
+}
+
+TEST(io_service, message_operations_shouldTransferMultipleBuffers) {
+    service_t          service({}, 8);
+    const socketpair_t pair;
+
+    std::array<char, 3>           header = {'a', 'b', 'c'};
+    std::array<char, 2>           body   = {'d', 'e'};
+    std::array<struct ::iovec, 2> source = {{
+        {.iov_base = header.data(), .iov_len = header.size()},
+        {.iov_base = body.data(), .iov_len = body.size()}}};
+    struct ::msghdr sent = {};
+    sent.msg_iov         = source.data();
+    sent.msg_iovlen      = source.size();
+
+    std::array<char, 5> data     = {};
+    struct ::iovec      target   = {.iov_base = data.data(), .iov_len = data.size()};
+    struct ::msghdr     received = {};
+    received.msg_iov             = &target;
+    received.msg_iovlen          = 1;
+
+    const auto w = start(service.sendmsg(pair.left(), sent));
+    const auto r = start(service.recvmsg(pair.right(), received, MSG_WAITALL));
+    service.run();
+
+    EXPECT_EQ(5, w.result());
+    EXPECT_EQ(5, r.result());
+    EXPECT_EQ("abcde", std::string_view(data.data(), data.size()));
+}
+
+auto recv(service_t &service, std::int32_t descriptor, rcs::io::buffer_ring &ring, rcs::io::lease &lease)
+    -> rcs::co::awaitable<std::int32_t> {
+    co_return co_await service.recv(descriptor, ring, lease);
+}
+
+auto roundtrip(service_t &service, std::int32_t out, std::int32_t in, const char *data, char *buffer,
+               std::uint32_t size) -> rcs::co::awaitable<std::vector<std::int32_t>> {
+    auto chain = service.link();
+    chain.write(out, data, size).read(in, buffer, size);
+    co_return co_await chain;
+}
+
+TEST(io_service, chain_shouldSubmitLinkedOperationsAtOnce) {
+    service_t    service({}, 8);
+    const pipe_t pipe;
+
+    std::array<char, 4> buffer = {};
+    const auto          r      = roundtrip(service, pipe.out(), pipe.in(), "ping", buffer.data(), 4);
+    service.run();
+
+    EXPECT_EQ((std::vector<std::int32_t>{4, 4}), r.result());
+    EXPECT_EQ("ping", std::string_view(buffer.data(), buffer.size()));
+    EXPECT_EQ(1U, service.stats().enters);
+    EXPECT_EQ(2U, service.stats().submitted);
+}
+
+TEST(io_service, chain_shouldCancelOperationsFollowingFailure) {
+    service_t    service({}, 8);
+    const pipe_t pipe;
+
+    std::array<char, 4> buffer = {};
+    const auto          r      = roundtrip(service, -1, pipe.in(), "ping", buffer.data(), 4);
+    service.run();
+
+    EXPECT_EQ((std::vector<std::int32_t>{-EBADF, -ECANCELED}), r.result());
+    EXPECT_TRUE(service.idle());
+}
+
+auto tolerant(service_t &service, std::int32_t out, const char *data, std::uint32_t size)
+    -> rcs::co::awaitable<std::vector<std::int32_t>> {
+    auto chain = service.link();
+    chain.write(-1, data, size).hard().write(out, data, size);
+    co_return co_await chain;
+}
+
+TEST(io_service, chain_shouldContinuePastHardLinkedFailure) {
+    service_t    service({}, 8);
+    const pipe_t pipe;
+
+    const auto r = tolerant(service, pipe.out(), "ping", 4);
+    service.run();
+
+    EXPECT_EQ((std::vector<std::int32_t>{-EBADF, 4}), r.result());
+}
+
+TEST(io_service, chain_shouldBeAdmittedAsWhole) {
+    service_t    service({}, 2);
+    const pipe_t pipe;
+
+    char       data    = 0;
+    const auto blocked = start(service.read(pipe.in(), &data, 1));
+
+    std::array<char, 4> buffer = {};
+    const pipe_t        other;
+    const auto          r = roundtrip(service, other.out(), other.in(), "ping", buffer.data(), 4);
+
+    EXPECT_EQ(1U, service.queued());
+    EXPECT_EQ(1, ::write(pipe.out(), "x", 1));
+    service.run();
+
+    EXPECT_EQ(1, blocked.result());
+    EXPECT_EQ((std::vector<std::int32_t>{4, 4}), r.result());
+}
+
+auto oversized(service_t &service, std::int32_t out, std::uint32_t count)
+    -> rcs::co::awaitable<std::vector<std::int32_t>> {
+    auto chain = service.link();
+    for (std::uint32_t index = 0; index < count; ++index) chain.write(out, "x", 1);
+    co_return co_await chain;
+}
+
+TEST(io_service, chain_shouldRejectMoreOperationsThanSubmissionQueueHolds) {
+    service_t    service({}, 4);
+    const pipe_t pipe;
+
+    const auto r = oversized(service, pipe.out(), 8);
+    service.run();
+
+    EXPECT_EQ(std::vector<std::int32_t>(8, -EINVAL), r.result());
+    EXPECT_TRUE(service.idle());
+    EXPECT_EQ(0U, service.stats().submitted);
+}
+
+TEST(io_service, detached_write_shouldNotCompleteVisibly) {
+    service_t    service({}, 8);
+    const pipe_t pipe;
+
+    service.write_detached(pipe.out(), "abc", 3);
+    if (service.capabilities().skip_success()) {
+        EXPECT_EQ(0U, service.pending());
+        EXPECT_TRUE(service.idle());
+    }
+    service.run();
+
+    std::array<char, 3> data = {};
+    EXPECT_EQ(3, ::read(pipe.in(), data.data(), data.size()));
+    EXPECT_EQ("abc", std::string_view(data.data(), data.size()));
+
+    EXPECT_EQ(0U, service.stats().failures);
+    if (service.capabilities().skip_success()) {
+        EXPECT_EQ(0U, service.stats().completions);
+    }
+}
+
+TEST(io_service, detached_write_shouldReportFailureToSink) {
+    service_t    service({}, 8);
+    const pipe_t pipe;
+
+    std::vector<std::int32_t> failures;
+    service.sink([&failures](std::int32_t error) { failures.push_back(error); });
+
+    // The read end of a pipe cannot be written to.
+    service.write_detached(pipe.in(), "x", 1);
+    service.run();
+
+    EXPECT_EQ(std::vector<std::int32_t>{-EBADF}, failures);
+    EXPECT_EQ(1U, service.stats().failures);
+    EXPECT_EQ(0U, service.pending());
+}
+
+TEST(io_service, detached_write_shouldBeSubmittedByEventProcessingLoop) {
+    service_t    service({}, 8, {.submission = rcs::io::submission::deferred});
+    const pipe_t pipe;
+
+    std::array<char, 2>                 head    = {'a', 'b'};
+    std::array<char, 1>                 tail    = {'c'};
+    const std::array<struct ::iovec, 2> vectors = {{
+        {.iov_base = head.data(), .iov_len = head.size()},
+        {.iov_base = tail.data(), .iov_len = tail.size()}}};
+    service.writev_detached(pipe.out(), vectors.data(), vectors.size());
+
+    EXPECT_FALSE(service.idle());
+    service.run();
+    EXPECT_TRUE(service.idle());
+
+    std::array<char, 3> data = {};
+    EXPECT_EQ(3, ::read(pipe.in(), data.data(), data.size()));
+    EXPECT_EQ("abc", std::string_view(data.data(), data.size()));
+}
+
+TEST(io_service, splice_shouldMoveDataBetweenPipes) {
+    service_t    service({}, 8);
+    const pipe_t source;
+    const pipe_t copy;
+    const pipe_t target;
+    EXPECT_EQ(3, ::write(source.out(), "abc", 3));
+
+    // The tee leaves the data in the source pipe for the splice to consume.
+    const auto t = start(service.tee(source.in(), copy.out(), 3));
+    service.run();
+    const auto s = start(service.splice(source.in(), -1, target.out(), -1, 3));
+    service.run();
+    EXPECT_EQ(3, t.result());
+    EXPECT_EQ(3, s.result());
+
+    std::array<char, 3> data = {};
+    EXPECT_EQ(3, ::read(copy.in(), data.data(), data.size()));
+    EXPECT_EQ("abc", std::string_view(data.data(), data.size()));
+    EXPECT_EQ(3, ::read(target.in(), data.data(), data.size()));
+    EXPECT_EQ("abc", std::string_view(data.data(), data.size()));
+}
+
+TEST(io_service, pipes_shouldReuseReleasedPipes) {
+    service_t service({}, 8);
+
+    std::int32_t in = -1;
+    {
+        const rcs::io::pipe pipe = service.pipes().acquire();
+        EXPECT_FALSE(pipe.empty());
+        EXPECT_NE(0U, pipe.capacity());
+        in = pipe.in();
+    }
+    EXPECT_EQ(1U, service.pipes().idle());
+
+    rcs::io::pipe pipe = service.pipes().acquire();
+    EXPECT_EQ(in, pipe.in());
+    EXPECT_EQ(0U, service.pipes().idle());
+
+    // A discarded pipe is closed instead.
+    pipe.discard();
+    EXPECT_TRUE(pipe.empty());
+    EXPECT_EQ(0U, service.pipes().idle());
+}
+
+TEST(io_service, post_shouldRunWorkOnEventProcessingLoop) {
+    service_t service({}, 8);
+
+    bool ran = false;
+    service.post([&ran] { ran = true; });
+
+    EXPECT_FALSE(service.idle());
+    EXPECT_FALSE(ran);
+    service.run();
+
+    EXPECT_TRUE(ran);
+    EXPECT_TRUE(service.idle());
+}
+
+TEST(io_service, post_shouldWakeUpWaitingThread) {
+    service_t    service({}, 8);
+    const pipe_t pipe;
+
+    char       data = 0;
+    const auto r    = start(service.read(pipe.in(), &data, 1));
+
+    std::atomic<bool> woken = false;
+    std::thread       loop([&] {
+        while (not woken.load()) service.run_one();
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    service.post([&woken] { woken.store(true); });
+    loop.join();
+
+    EXPECT_FALSE(r.done());
+    EXPECT_EQ(1, ::write(pipe.out(), "x", 1));
+    service.run();
+    EXPECT_EQ(1, r.result());
+}
+
+// Have the calling thread, and the ones it creates, fail to message rings
+// without a ring, as kernels older than 6.13 do.
+auto refuse_direct_messages() -> bool {
+    std::array<struct ::sock_filter, 6> filter = {{
+        BPF_STMT(BPF_LD | BPF_W | BPF_ABS, offsetof(struct ::seccomp_data, nr)),
+        BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, __NR_io_uring_register, 0, 3),
+        BPF_STMT(BPF_LD | BPF_W | BPF_ABS, offsetof(struct ::seccomp_data, args[1])),
+        BPF_JUMP(BPF_JMP | BPF_JEQ | BPF_K, static_cast<std::uint32_t>(rcs::io::uring::reg::send_msg_ring), 0, 1),
+        BPF_STMT(BPF_RET | BPF_K, SECCOMP_RET_ERRNO | EINVAL),
+        BPF_STMT(BPF_RET | BPF_K, SECCOMP_RET_ALLOW),
+    }};
+    struct ::sock_fprog program = {.len = filter.size(), .filter = filter.data()};
+
+    return ::prctl(PR_SET_NO_NEW_PRIVS, 1, 0, 0, 0) == 0 and
+           ::prctl(PR_SET_SECCOMP, SECCOMP_MODE_FILTER, &program) == 0;
+}
+
+TEST(io_service, post_shouldWakeUpWaitingThreadWithoutDirectMessages) {
+    // The filter cannot be lifted, so the test runs in a child process,
+    // which is killed if the loop is never woken up.
+    const ::pid_t child = ::fork();
+    ASSERT_NE(-1, child);
+
+    if (child == 0) {
+        ::alarm(5);
+        if (not refuse_direct_messages()) ::_exit(2);
+
+        service_t service({}, 8, {.submission = rcs::io::submission::deferred});
+        if (service.capabilities().direct_messages()) ::_exit(3);
+
+        const pipe_t pipe;
+        char         data = 0;
+        const auto   r    = start(service.read(pipe.in(), &data, 1));
+
+        std::atomic<bool> woken = false;
+        std::thread       loop([&] {
+            while (not woken.load()) service.run_one();
+        });
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        service.post([&woken] { woken.store(true); });
+        loop.join();
+
+        ::_exit(r.done() ? 4 : 0);
+    }
+
+    int status = 0;
+    ASSERT_EQ(child, ::waitpid(child, &status, 0));
+    ASSERT_TRUE(WIFEXITED(status));
+    EXPECT_EQ(0, WEXITSTATUS(status));
+}
+
+TEST(io_service, post_shouldMessageAnotherService) {
+    service_t source({}, 8);
+    service_t target({}, 8);
+
+    bool ran = false;
+    source.post(target, [&ran] { ran = true; });
+
+    EXPECT_FALSE(target.idle());
+    source.run();
+    EXPECT_FALSE(ran);
+    target.run();
+
+    EXPECT_TRUE(ran);
+    EXPECT_TRUE(source.idle());
+    EXPECT_TRUE(target.idle());
+}
+
+TEST(io_service, recv_shouldLeaseBufferPickedFromRing) {
+    service_t            service({}, 8);
+    rcs::io::buffer_ring &ring = service.provide(4, 64);
+    const socketpair_t   sockets;
+    rcs::io::lease       lease;
+
+    auto received = recv(service, sockets.left(), ring, lease);
+    EXPECT_EQ(5, ::write(sockets.right(), "hello", 5));
+    service.run();
+
+    EXPECT_EQ(5, received.result());
+    ASSERT_FALSE(lease.empty());
+    EXPECT_EQ(5U, lease.size());
+    EXPECT_EQ("hello", std::string_view(reinterpret_cast<const char *>(lease.data()), lease.size()));
+}
+
+TEST(io_service, recv_shouldReuseReleasedBuffers) {
+    service_t            service({}, 8);
+    rcs::io::buffer_ring &ring = service.provide(1, 64);
+    const socketpair_t   sockets;
+    rcs::io::lease       first;
+    rcs::io::lease       second;
+
+    EXPECT_EQ(2, ::write(sockets.right(), "ab", 2));
+    auto leased = recv(service, sockets.left(), ring, first);
+    service.run();
+    EXPECT_EQ(2, leased.result());
+
+    // The only buffer is leased, so the kernel has none to pick.
+    EXPECT_EQ(2, ::write(sockets.right(), "cd", 2));
+    auto exhausted = recv(service, sockets.left(), ring, second);
+    service.run();
+    EXPECT_EQ(-ENOBUFS, exhausted.result());
+    EXPECT_TRUE(second.empty());
+
+    first.release();
+    auto reused = recv(service, sockets.left(), ring, second);
+    service.run();
+    EXPECT_EQ(2, reused.result());
+    EXPECT_EQ(0U, second.index());
+}
+
+TEST(io_service, write_shouldReferToRegisteredFile) {
+    service_t    service({}, 8);
+    const pipe_t pipe;
+
+    auto            &files = service.register_files(4);
+    const rcs::io::slot slot  = files.acquire(pipe.out());
+
+    const auto w = write(service, static_cast<std::int32_t>(slot.index()), "x", 1,
+                         rcs::io::uring::SQE_FIXED_FILE);
+    service.run();
+    EXPECT_EQ(1, w.result());
+
+    char data = 0;
+    EXPECT_EQ(1, ::read(pipe.in(), &data, 1));
+    EXPECT_EQ('x', data);
+}
+
+TEST(io_service, file_table_shouldRecycleReleasedSlots) {
+    service_t    service({}, 8);
+    const pipe_t pipe;
+
+    auto &files = service.register_files(2);
+
+    rcs::io::slot       first  = files.acquire(pipe.in());
+    const rcs::io::slot second = files.acquire(pipe.out());
+    EXPECT_NE(first.index(), second.index());
+    EXPECT_EQ(0U, files.available());
+    EXPECT_THROW((void)files.acquire(pipe.in()), rcs::system::exception);
+
+    const std::uint32_t index = first.index();
+    first.reset();
+    EXPECT_EQ(1U, files.available());
+
+    const rcs::io::slot third = files.acquire(pipe.in());
+    EXPECT_EQ(index, third.index());
+}
+
+TEST(io_service, fixed_operations_shouldTransferThroughRegisteredBuffers) {
+    service_t    service({}, 8);
+    const pipe_t pipe;
+
+    auto               &arena  = service.register_buffers(2, 64);
+    const rcs::io::slice source = arena.acquire();
+    const rcs::io::slice target = arena.acquire();
+    EXPECT_NE(source.index(), target.index());
+
+    constexpr std::string_view message = "hello";
+    std::ranges::copy(message, source.bytes().begin());
+
+    const auto w = start(service.write_fixed(pipe.out(), source, message.size()));
+    const auto r = start(service.read_fixed(pipe.in(), target, target.size()));
+    service.run();
+
+    EXPECT_EQ(static_cast<std::int32_t>(message.size()), w.result());
+    EXPECT_EQ(static_cast<std::int32_t>(message.size()), r.result());
+    EXPECT_EQ(message, std::string_view(reinterpret_cast<const char *>(target.data()), message.size()));
+}
+
+TEST(io_service, buffer_arena_shouldRecycleReleasedSlices) {
+    service_t service({}, 8);
+
+    auto &arena = service.register_buffers(1, 64);
+
+    rcs::io::slice slice = arena.acquire();
+    EXPECT_EQ(0U, arena.available());
+    EXPECT_THROW((void)arena.acquire(), rcs::system::exception);
+
+    const std::uint16_t index = slice.index();
+    slice.release();
+    EXPECT_TRUE(slice.empty());
+    EXPECT_EQ(index, arena.acquire().index());
+}
+
+} // namespace
@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+
+#include <rcs/co/awaitable.hpp>
+#include <rcs/execution/inline_executor.hpp>
+#include <rcs/io/service_pool.hpp>
+#include <rcs/ip/address.hpp>
+#include <rcs/ip/endpoint.hpp>
+#include <rcs/ip/socket.hpp>
+#include <rcs/ip/v4.hpp>
+#include <rcs/system/exception.hpp>
+#include <rcs/system/timeout.hpp>
+
+#include <netinet/in.h>
+#include <sched.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+#include <cstdint>
+
+namespace {
+
+using pool_t    = rcs::io::service_pool<rcs::execution::inline_executor>;
+using service_t = pool_t::service_t;
+using socket_t  = rcs::ip::v4::tcp::socket<rcs::execution::inline_executor>;
+
+auto echo(service_t &service, std::int32_t cpu, std::atomic<std::uint32_t> &pinned)
+    -> rcs::co::awaitable<void> {
+    std::array<std::int32_t, 2> pipe = {-1, -1};
+    EXPECT_EQ(0, ::pipe(pipe.data()));
+
+    char data = 'x';
+    EXPECT_EQ(1, co_await service.write(pipe[1], &data, 1));
+    EXPECT_EQ(1, co_await service.read(pipe[0], &data, 1));
+    if (::sched_getcpu() == cpu) pinned.fetch_add(1);
+
+    ::close(pipe[0]), ::close(pipe[1]);
+}
+
+TEST(io_service_pool, start_shouldRunWorkOnEveryServiceOnItsProcessor) {
+    pool_t                     pool(8);
+    std::atomic<std::uint32_t> pinned = 0;
+
+    pool.start([&pool, &pinned](service_t &service, std::uint32_t index) {
+        return echo(service, pool.cpu(index), pinned);
+    });
+    pool.join();
+
+    EXPECT_EQ(pool.size(), pinned.load());
+}
+
+auto fail(service_t &service) -> rcs::co::awaitable<void> {
+    char data = 0;
+    if (co_await service.read(-1, &data, 1) < 0) throw rcs::system::exception(EBADF);
+}
+
+TEST(io_service_pool, join_shouldRethrowExceptionOfWork) {
+    pool_t pool(2, 8);
+
+    pool.start([](service_t &service, std::uint32_t) { return fail(service); });
+
+    EXPECT_THROW(pool.join(), rcs::system::exception);
+}
+
+auto drain(socket_t &listener, std::atomic<std::uint32_t> &accepted, std::atomic<std::uint32_t> &sharded)
+    -> rcs::co::awaitable<void> {
+    std::uint32_t count = 0;
+    try {
+        while (true) {
+            (void)co_await listener.accept(std::chrono::milliseconds(200));
+            ++count;
+        }
+    } catch (const rcs::system::timeout &) {}
+
+    accepted.fetch_add(count);
+    if (count != 0) sharded.fetch_add(1);
+}
+
+TEST(io_service_pool, reuse_port_shouldSpreadConnectionsAcrossServices) {
+    constexpr std::uint32_t CONNECTIONS = 64;
+
+    pool_t pool(2, 8);
+
+    std::vector<std::unique_ptr<socket_t>> listeners;
+    std::uint16_t                          port = 0;
+    for (std::uint32_t index = 0; index < pool.size(); ++index) {
+        auto &listener = *listeners.emplace_back(std::make_unique<socket_t>(pool.at(index)));
+        listener.open();
+        listener.reuse_port();
+        listener.bind(rcs::ip::v4::endpoint(rcs::ip::v4::address::loopback(), port));
+        listener.listen(CONNECTIONS);
+
+        struct ::sockaddr_in address = {};
+        ::socklen_t          size    = sizeof(address);
+        EXPECT_EQ(0, ::getsockname(listener.descriptor(), reinterpret_cast<struct ::sockaddr *>(&address), &size));
+        port = ntohs(address.sin_port);
+    }
+
+    // Connections from distinct source ports hash to the listeners evenly
+    // enough for every listener to get some.
+    std::vector<std::int32_t> clients;
+    for (std::uint32_t index = 0; index < CONNECTIONS; ++index) {
+        const rcs::ip::v4::endpoint endpoint(rcs::ip::v4::address::loopback(), port);
+        clients.push_back(::socket(AF_INET, SOCK_STREAM, 0));
+        EXPECT_EQ(0, ::connect(clients.back(), &endpoint.data(), endpoint.size()));
+    }
+
+    std::atomic<std::uint32_t> accepted = 0;
+    std::atomic<std::uint32_t> sharded  = 0;
+    pool.start([&](service_t &, std::uint32_t index) {
+        return drain(*listeners[index], accepted, sharded);
+    });
+    pool.join();
+
+    for (const std::int32_t client : clients) ::close(client);
+
+    EXPECT_EQ(CONNECTIONS, accepted.load());
+    EXPECT_EQ(pool.size(), sharded.load());
+}
+
+} // namespace
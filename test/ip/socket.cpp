@@ -0,0 +1,599 @@
+#include <gtest/gtest.h>
+
+#include <rcs/co/awaitable.hpp>
+#include <rcs/execution/inline_executor.hpp>
+#include <rcs/io/buffer_ring.hpp>
+#include <rcs/io/file.hpp>
+#include <rcs/io/lease.hpp>
+#include <rcs/io/service.hpp>
+#include <rcs/ip/address.hpp>
+#include <rcs/ip/endpoint.hpp>
+#include <rcs/ip/relay.hpp>
+#include <rcs/ip/socket.hpp>
+#include <rcs/ip/v4.hpp>
+#include <rcs/system/exception.hpp>
+#include <rcs/system/timeout.hpp>
+
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace {
+
+using service_t = rcs::io::service<rcs::execution::inline_executor>;
+using socket_t  = rcs::ip::v4::tcp::socket<rcs::execution::inline_executor>;
+using file_t    = rcs::io::file<rcs::execution::inline_executor>;
+
+auto listen(socket_t &listener) -> std::uint16_t {
+    listener.open();
+    listener.bind(rcs::ip::v4::endpoint(rcs::ip::v4::address::loopback(), 0));
+    listener.listen(16);
+
+    struct ::sockaddr_in address = {};
+    ::socklen_t          size    = sizeof(address);
+    EXPECT_EQ(0, ::getsockname(listener.descriptor(), reinterpret_cast<struct ::sockaddr *>(&address), &size));
+    return ntohs(address.sin_port);
+}
+
+auto connect(std::uint16_t port) -> std::int32_t {
+    const rcs::ip::v4::endpoint endpoint(rcs::ip::v4::address::loopback(), port);
+
+    const std::int32_t descriptor = ::socket(AF_INET, SOCK_STREAM, 0);
+    EXPECT_EQ(0, ::connect(descriptor, &endpoint.data(), endpoint.size()));
+    return descriptor;
+}
+
+auto accept(socket_t &listener, int count) -> rcs::co::awaitable<int> {
+    auto connections = listener.incoming();
+    int  accepted    = 0;
+    while (accepted < count) {
+        const auto connection = co_await connections.next();
+        if (not connection.has_value()) break;
+        EXPECT_NE(-1, connection->descriptor());
+        ++accepted;
+    }
+    co_return accepted;
+}
+
+auto echo(socket_t &listener) -> rcs::co::awaitable<char> {
+    socket_t connection = co_await listener.accept();
+    connection.register_file();
+    EXPECT_TRUE(connection.fixed());
+
+    char data = 0;
+    EXPECT_EQ(1U, co_await connection.recv(&data, 1));
+    EXPECT_EQ(1U, co_await connection.send(&data, 1));
+    co_return data;
+}
+
+auto recv(socket_t &listener, std::chrono::nanoseconds timeout) -> rcs::co::awaitable<bool> {
+    socket_t connection = co_await listener.accept();
+
+    char data = 0;
+    try {
+        (void)co_await connection.recv(&data, 1, timeout);
+    } catch (const rcs::system::timeout &) {
+        co_return true;
+    }
+    co_return false;
+}
+
+auto recv(socket_t &connection) -> rcs::co::awaitable<std::int32_t> {
+    char data = 0;
+    try {
+        (void)co_await connection.recv(&data, 1);
+    } catch (const rcs::system::exception &e) {
+        co_return e.error_code();
+    }
+    co_return 0;
+}
+
+auto recvall(service_t &service, socket_t &listener, std::vector<std::uint8_t> &received,
+             std::uint64_t &completions)
+    -> rcs::co::awaitable<void> {
+    socket_t connection = co_await listener.accept();
+
+    auto                size   = static_cast<std::uint32_t>(received.size());
+    const std::uint64_t before = service.stats().completions;
+    co_await connection.recvall(received.data(), &size);
+    completions = service.stats().completions - before;
+    received.resize(size);
+}
+
+auto sendall(service_t &service, socket_t &listener, const std::vector<std::uint8_t> &payload,
+             std::uint64_t &completions)
+    -> rcs::co::awaitable<std::uint32_t> {
+    socket_t connection = co_await listener.accept();
+
+    auto                size   = static_cast<std::uint32_t>(payload.size());
+    const std::uint64_t before = service.stats().completions;
+    co_await connection.sendall(payload.data(), &size);
+    completions = service.stats().completions - before;
+    co_return size;
+}
+
+auto sendfile(service_t &service, socket_t &listener, std::string path, std::uint64_t offset,
+              std::uint64_t length)
+    -> rcs::co::awaitable<std::uint64_t> {
+    socket_t connection = co_await listener.accept();
+
+    file_t file(service);
+    co_await file.open(path, O_RDONLY);
+    const std::uint64_t sent = co_await connection.sendfile(file, offset, length);
+    co_await file.close();
+    co_return sent;
+}
+
+auto relay(socket_t &listener) -> rcs::co::awaitable<rcs::ip::traffic> {
+    socket_t client = co_await listener.accept();
+    socket_t server = co_await listener.accept();
+    co_return co_await rcs::ip::relay(client, server);
+}
+
+/// @brief Send a payload, then read until the end of the connection.
+auto exchange(std::int32_t descriptor, const std::vector<std::uint8_t> &payload, bool first)
+    -> std::vector<std::uint8_t> {
+    std::vector<std::uint8_t> received;
+    std::array<std::uint8_t, 65536> buffer = {};
+
+    const auto send = [&] {
+        EXPECT_EQ(static_cast<::ssize_t>(payload.size()),
+                  ::send(descriptor, payload.data(), payload.size(), MSG_WAITALL));
+        ::shutdown(descriptor, SHUT_WR);
+    };
+    const auto recv = [&] {
+        ::ssize_t rv = 0;
+        while ((rv = ::read(descriptor, buffer.data(), buffer.size())) > 0)
+            received.insert(received.end(), buffer.begin(), buffer.begin() + rv);
+    };
+
+    // One side speaks first, the other one answers once it is done.
+    if (first)
+        send(), recv();
+    else
+        recv(), send();
+    return received;
+}
+
+auto sendall_zc(socket_t &listener, const std::vector<std::uint8_t> &payload)
+    -> rcs::co::awaitable<std::uint32_t> {
+    socket_t connection = co_await listener.accept();
+
+    auto size = static_cast<std::uint32_t>(payload.size());
+    co_await connection.sendall_zc(payload.data(), &size);
+    co_return size;
+}
+
+auto sendall_zc(socket_t &listener, std::uint32_t size) -> rcs::co::awaitable<std::int32_t> {
+    socket_t connection = co_await listener.accept();
+
+    // The first sends may still be taken in before the peer resets.
+    const std::vector<std::uint8_t> payload(size);
+    try {
+        while (true) {
+            std::uint32_t sent = size;
+            co_await connection.sendall_zc(payload.data(), &sent);
+        }
+    } catch (const rcs::system::exception &e) {
+        co_return e.error_code();
+    }
+}
+
+auto chunks(socket_t &listener, rcs::io::buffer_ring &ring, std::vector<std::uint8_t> &received)
+    -> rcs::co::awaitable<std::uint32_t> {
+    socket_t connection = co_await listener.accept();
+
+    auto          chunks = connection.chunks(ring);
+    std::uint32_t count  = 0;
+    while (true) {
+        const auto chunk = co_await chunks.next();
+        if (not chunk.has_value()) break;
+        received.insert(received.end(), chunk->data(), chunk->data() + chunk->size());
+        ++count;
+    }
+    co_return count;
+}
+
+auto hoard(socket_t &listener, rcs::io::buffer_ring &ring, std::vector<rcs::io::lease> &held)
+    -> rcs::co::awaitable<std::int32_t> {
+    socket_t connection = co_await listener.accept();
+
+    auto chunks = connection.chunks(ring);
+    try {
+        while (true) {
+            auto chunk = co_await chunks.next();
+            if (not chunk.has_value()) break;
+            held.push_back(std::move(*chunk));
+        }
+    } catch (const rcs::system::exception &e) {
+        co_return e.error_code();
+    }
+    co_return 0;
+}
+
+auto recvv(socket_t &listener, std::span<std::uint8_t> first, std::span<std::uint8_t> second)
+    -> rcs::co::awaitable<std::uint32_t> {
+    socket_t connection = co_await listener.accept();
+
+    const std::array<std::span<std::uint8_t>, 2> buffers = {first, second};
+    std::uint32_t                                total   = 0;
+    while (total < first.size() + second.size()) {
+        // Skip what has been received already.
+        std::uint32_t                          skip = total;
+        std::array<std::span<std::uint8_t>, 2> rest = buffers;
+        for (std::span<std::uint8_t> &buffer : rest) {
+            const std::size_t count = std::min<std::size_t>(skip, buffer.size());
+            buffer                  = buffer.subspan(count);
+            skip -= count;
+        }
+
+        const std::uint32_t rv = co_await connection.recvv(rest);
+        if (rv == 0) break;
+        total += rv;
+    }
+    co_return total;
+}
+
+auto sendv(socket_t &connection, std::span<const std::uint8_t> header, std::span<const std::uint8_t> body)
+    -> rcs::co::awaitable<std::uint32_t> {
+    const std::array<std::span<const std::uint8_t>, 2> buffers = {header, body};
+    co_return co_await connection.sendv(buffers);
+}
+
+TEST(ip_socket, incoming_shouldYieldAcceptedConnections) {
+    service_t           service({}, 8);
+    socket_t            listener(service);
+    const std::uint16_t port = listen(listener);
+
+    std::int32_t clients[3];
+    for (std::int32_t &client : clients) client = connect(port);
+
+    auto accepted = accept(listener, 3);
+    while (not accepted.done()) service.run_one();
+    EXPECT_EQ(3, accepted.result());
+
+    // Closing the stream cancels the multishot operation.
+    service.run();
+    EXPECT_TRUE(service.idle());
+
+    for (const std::int32_t client : clients) ::close(client);
+}
+
+TEST(ip_socket, register_file_shouldAddressSocketBySlot) {
+    service_t service({}, 8);
+    (void)service.register_files(4);
+
+    socket_t            listener(service);
+    const std::uint16_t port = listen(listener);
+    listener.register_file();
+    EXPECT_TRUE(listener.fixed());
+
+    const std::int32_t client = connect(port);
+    EXPECT_EQ(1, ::write(client, "x", 1));
+
+    auto echoed = echo(listener);
+    service.run();
+    EXPECT_EQ('x', echoed.result());
+
+    char data = 0;
+    EXPECT_EQ(1, ::read(client, &data, 1));
+    EXPECT_EQ('x', data);
+
+    listener.close();
+    EXPECT_FALSE(listener.fixed());
+    EXPECT_EQ(4U, service.files()->available());
+
+    ::close(client);
+}
+
+TEST(ip_socket, recv_shouldThrowTimeoutAfterDeadline) {
+    service_t           service({}, 8);
+    socket_t            listener(service);
+    const std::uint16_t port = listen(listener);
+
+    const std::int32_t client = connect(port);
+
+    auto timedout = recv(listener, std::chrono::milliseconds(10));
+    service.run();
+    EXPECT_TRUE(timedout.result());
+
+    ::close(client);
+}
+
+TEST(ip_socket, recv_shouldThrowErrorCode) {
+    service_t service({}, 8);
+    socket_t  unconnected(service);
+    unconnected.open();
+
+    auto error = recv(unconnected);
+    service.run();
+    EXPECT_EQ(ENOTCONN, error.result());
+}
+
+TEST(ip_socket, recvall_shouldReceiveWholeFrameInSingleOperation) {
+    service_t           service({}, 8);
+    socket_t            listener(service);
+    const std::uint16_t port = listen(listener);
+
+    std::vector<std::uint8_t> payload(1 << 20);
+    for (std::size_t index = 0; index < payload.size(); ++index)
+        payload[index] = static_cast<std::uint8_t>(index);
+
+    // The frame arrives in pieces.
+    const std::int32_t client = connect(port);
+    std::thread        writer([&] {
+        for (std::size_t offset = 0; offset < payload.size(); offset += 4096)
+            EXPECT_EQ(4096, ::write(client, payload.data() + offset, 4096));
+    });
+
+    std::vector<std::uint8_t> received(payload.size());
+    std::uint64_t             completions = 0;
+    auto                      task        = recvall(service, listener, received, completions);
+    service.run();
+    writer.join();
+    task.rethrow_exception();
+
+    EXPECT_EQ(payload, received);
+    EXPECT_EQ(1U, completions);
+
+    ::close(client);
+}
+
+TEST(ip_socket, recvall_shouldStopShortOnlyAtEndOfConnection) {
+    service_t           service({}, 8);
+    socket_t            listener(service);
+    const std::uint16_t port = listen(listener);
+
+    const std::int32_t client = connect(port);
+    EXPECT_EQ(3, ::write(client, "abc", 3));
+    ::close(client);
+
+    std::vector<std::uint8_t> received(8);
+    std::uint64_t             completions = 0;
+    auto                      task        = recvall(service, listener, received, completions);
+    service.run();
+    task.rethrow_exception();
+
+    EXPECT_EQ((std::vector<std::uint8_t>{'a', 'b', 'c'}), received);
+}
+
+TEST(ip_socket, sendall_shouldSendWholeFrameInSingleOperation) {
+    service_t           service({}, 8);
+    socket_t            listener(service);
+    const std::uint16_t port = listen(listener);
+
+    std::vector<std::uint8_t> payload(1 << 20);
+    for (std::size_t index = 0; index < payload.size(); ++index)
+        payload[index] = static_cast<std::uint8_t>(index * 3);
+
+    const std::int32_t        client = connect(port);
+    std::vector<std::uint8_t> received;
+    std::thread               reader([&] {
+        std::array<std::uint8_t, 65536> buffer = {};
+        ::ssize_t                       rv     = 0;
+        while (received.size() < payload.size() and (rv = ::read(client, buffer.data(), buffer.size())) > 0)
+            received.insert(received.end(), buffer.begin(), buffer.begin() + rv);
+    });
+
+    std::uint64_t completions = 0;
+    auto          sent        = sendall(service, listener, payload, completions);
+    service.run();
+    reader.join();
+
+    EXPECT_EQ(payload.size(), sent.result());
+    EXPECT_EQ(payload, received);
+    EXPECT_EQ(1U, completions);
+
+    ::close(client);
+}
+
+TEST(ip_socket, sendfile_shouldSpliceFileRangeUntilEndOfFile) {
+    service_t           service({}, 8);
+    socket_t            listener(service);
+    const std::uint16_t port = listen(listener);
+
+    // Larger than a pipe, so that the range is sent in several pieces.
+    std::vector<std::uint8_t> contents(3 << 20);
+    for (std::size_t index = 0; index < contents.size(); ++index)
+        contents[index] = static_cast<std::uint8_t>(index * 5);
+
+    const std::string  path       = "/tmp/rcs-sendfile-" + std::to_string(::getpid());
+    const std::int32_t descriptor = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    ASSERT_NE(-1, descriptor);
+    EXPECT_EQ(static_cast<::ssize_t>(contents.size()), ::write(descriptor, contents.data(), contents.size()));
+    ::close(descriptor);
+
+    const std::int32_t        client = connect(port);
+    std::vector<std::uint8_t> received;
+    std::thread               reader([&] {
+        std::array<std::uint8_t, 65536> buffer = {};
+        ::ssize_t                       rv     = 0;
+        while ((rv = ::read(client, buffer.data(), buffer.size())) > 0)
+            received.insert(received.end(), buffer.begin(), buffer.begin() + rv);
+    });
+
+    // The requested range extends past the end of the file.
+    const std::uint64_t offset = 1000;
+    auto                sent   = sendfile(service, listener, path, offset, contents.size());
+    service.run();
+    sent.rethrow_exception();
+    reader.join();
+    ::unlink(path.c_str());
+
+    EXPECT_EQ(contents.size() - offset, sent.result());
+    EXPECT_TRUE(std::equal(received.begin(), received.end(), contents.begin() + offset, contents.end()));
+    EXPECT_EQ(1U, service.pipes().idle());
+
+    ::close(client);
+}
+
+TEST(ip_socket, relay_shouldForwardBothDirectionsAndHalfClose) {
+    service_t           service({}, 8);
+    socket_t            listener(service);
+    const std::uint16_t port = listen(listener);
+
+    // Larger than a pipe, so that the request is relayed in several pieces.
+    std::vector<std::uint8_t> request(3 << 20);
+    for (std::size_t index = 0; index < request.size(); ++index)
+        request[index] = static_cast<std::uint8_t>(index * 7);
+    const std::vector<std::uint8_t> response(4096, 'r');
+
+    // The server only sees the end of the request once the half-close of
+    // the client has been relayed, and only then responds.
+    const std::int32_t        client = connect(port);
+    const std::int32_t        server = connect(port);
+    std::vector<std::uint8_t> responded;
+    std::vector<std::uint8_t> requested;
+    std::thread               first([&] { responded = exchange(client, request, true); });
+    std::thread               second([&] { requested = exchange(server, response, false); });
+
+    const auto traffic = relay(listener);
+    service.run();
+    traffic.rethrow_exception();
+    first.join();
+    second.join();
+
+    EXPECT_EQ(request.size(), traffic.result().forward);
+    EXPECT_EQ(response.size(), traffic.result().backward);
+    EXPECT_EQ(request, requested);
+    EXPECT_EQ(response, responded);
+    EXPECT_EQ(2U, service.pipes().idle());
+
+    ::close(client);
+    ::close(server);
+}
+
+TEST(ip_socket, sendall_zc_shouldDeliverWholePayload) {
+    service_t           service({}, 8);
+    socket_t            listener(service);
+    const std::uint16_t port = listen(listener);
+
+    std::vector<std::uint8_t> payload(1 << 20);
+    for (std::size_t index = 0; index < payload.size(); ++index)
+        payload[index] = static_cast<std::uint8_t>(index);
+
+    const std::int32_t        client = connect(port);
+    std::vector<std::uint8_t> received;
+    std::thread               reader([&] {
+        std::array<std::uint8_t, 65536> buffer = {};
+        ::ssize_t                       rv     = 0;
+        while ((rv = ::read(client, buffer.data(), buffer.size())) > 0)
+            received.insert(received.end(), buffer.begin(), buffer.begin() + rv);
+    });
+
+    auto sent = sendall_zc(listener, payload);
+    service.run();
+    EXPECT_EQ(payload.size(), sent.result());
+
+    reader.join();
+    EXPECT_EQ(payload, received);
+
+    ::close(client);
+}
+
+TEST(ip_socket, sendall_zc_shouldThrowErrorCodeWithoutSignal) {
+    service_t           service({}, 8);
+    socket_t            listener(service);
+    const std::uint16_t port = listen(listener);
+
+    ::close(connect(port));
+
+    // Below the zero-copy threshold, so that the payload is copied.
+    auto error = sendall_zc(listener, 16);
+    service.run();
+    EXPECT_TRUE(error.result() == EPIPE or error.result() == ECONNRESET);
+}
+
+TEST(ip_socket, chunks_shouldYieldDataUntilConnectionCloses) {
+    service_t            service({}, 8);
+    rcs::io::buffer_ring &ring = service.provide(16, 4096);
+    socket_t             listener(service);
+    const std::uint16_t  port = listen(listener);
+
+    std::vector<std::uint8_t> payload(1 << 18);
+    for (std::size_t index = 0; index < payload.size(); ++index)
+        payload[index] = static_cast<std::uint8_t>(index * 7);
+
+    const std::int32_t client = connect(port);
+    std::thread        writer([&] {
+        EXPECT_EQ(static_cast<::ssize_t>(payload.size()), ::write(client, payload.data(), payload.size()));
+        ::close(client);
+    });
+
+    std::vector<std::uint8_t> received;
+    auto                      count = chunks(listener, ring, received);
+    service.run();
+    writer.join();
+
+    EXPECT_EQ(payload, received);
+
+    // A receive is only re-armed once the ring has run dry, rather than
+    // for every chunk.
+    EXPECT_GE(count.result(), payload.size() / 4096);
+    EXPECT_LT(service.stats().submitted, count.result());
+}
+
+TEST(ip_socket, chunks_shouldThrowOnceEveryBufferIsHeld) {
+    service_t            service({}, 8);
+    rcs::io::buffer_ring &ring = service.provide(2, 16);
+    socket_t             listener(service);
+    const std::uint16_t  port = listen(listener);
+
+    const std::int32_t              client  = connect(port);
+    const std::vector<std::uint8_t> payload(64, 'x');
+    EXPECT_EQ(static_cast<::ssize_t>(payload.size()), ::write(client, payload.data(), payload.size()));
+
+    // Every chunk is kept, so that the ring cannot refill.
+    std::vector<rcs::io::lease> held;
+    const auto                  error = hoard(listener, ring, held);
+    service.run();
+
+    EXPECT_EQ(ENOBUFS, error.result());
+    EXPECT_EQ(2U, held.size());
+    EXPECT_EQ(2U, ring.leased());
+    EXPECT_LT(service.stats().submitted, 8U);
+
+    held.clear();
+    EXPECT_EQ(0U, ring.leased());
+    ::close(client);
+}
+
+TEST(ip_socket, sendv_shouldSendBuffersInOrder) {
+    service_t           service({}, 8);
+    socket_t            listener(service);
+    const std::uint16_t port = listen(listener);
+
+    socket_t client(service);
+    client.open();
+
+    auto connected = client.connect(rcs::ip::v4::endpoint(rcs::ip::v4::address::loopback(), port));
+
+    std::array<std::uint8_t, 4> first    = {};
+    std::array<std::uint8_t, 4> second   = {};
+    auto                        received = recvv(listener, first, second);
+
+    const std::array<std::uint8_t, 3> header = {'h', 'd', 'r'};
+    const std::array<std::uint8_t, 5> body   = {'b', 'o', 'd', 'y', '!'};
+    while (not connected.done()) service.run_one();
+    auto sent = sendv(client, header, body);
+
+    service.run();
+    EXPECT_EQ(8U, sent.result());
+    EXPECT_EQ(8U, received.result());
+    EXPECT_EQ((std::array<std::uint8_t, 4>{'h', 'd', 'r', 'b'}), first);
+    EXPECT_EQ((std::array<std::uint8_t, 4>{'o', 'd', 'y', '!'}), second);
+}
+
+} // namespace